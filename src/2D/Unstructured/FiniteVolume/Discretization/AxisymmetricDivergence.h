@@ -24,7 +24,7 @@ FiniteVolumeEquation<T> div(const VectorFiniteVolumeField &u,
             Scalar flux0 = dot(u0(nb.face()), sf);
 
             eqn.add(cell, cell, std::max(flux, 0.) * theta);
-            eqn.add(cell, nb.cell(), std::min(flux, 0.) * theta);
+            eqn.add(cell, nb, std::min(flux, 0.) * theta);
             eqn.addSource(cell, (std::max(flux0, 0.) * phi0(cell)
                                  + std::min(flux0, 0.) * phi0(nb.cell())) * (1. - theta));
         }
@@ -12,7 +12,7 @@ FiniteVolumeEquation<Scalar> axi::laplacian(Scalar gamma,
             Vector2D sf = nb.polarOutwardNorm();
             Scalar flux = gamma * dot(nb.rc(), sf) / nb.rc().magSqr();
             eqn.add(cell, cell, -flux);
-            eqn.add(cell, nb.cell(), flux);
+            eqn.add(cell, nb, flux);
         }
 
         for (const BoundaryLink &bd: cell.boundaries())
@@ -51,7 +51,7 @@ FiniteVolumeEquation<Scalar> axi::laplacian(const ScalarFiniteVolumeField &gamma
             Vector2D sf = nb.polarOutwardNorm();
             Scalar flux = gamma(nb.face()) * dot(nb.rc(), sf) / nb.rc().magSqr();
             eqn.add(cell, cell, -flux);
-            eqn.add(cell, nb.cell(), flux);
+            eqn.add(cell, nb, flux);
         }
 
         for (const BoundaryLink &bd: cell.boundaries())
@@ -94,7 +94,7 @@ FiniteVolumeEquation<Vector2D> axi::laplacian(Scalar gamma,
             Scalar flux = gamma * dot(nb.rc(), sf) / nb.rc().magSqr();
 
             eqn.add(cell, cell, -theta * flux);
-            eqn.add(cell, nb.cell(), theta * flux);
+            eqn.add(cell, nb, theta * flux);
             eqn.addSource(cell, (1. - theta) * flux * (u0(nb.cell()) - u0(cell)));
         }
 
@@ -155,7 +155,7 @@ FiniteVolumeEquation<Vector2D> axi::laplacian(const ScalarFiniteVolumeField &gam
             Scalar flux0 = gamma0(nb.face()) * dot(nb.rc(), sf) / nb.rc().magSqr();
 
             eqn.add(cell, cell, -theta * flux);
-            eqn.add(cell, nb.cell(), theta * flux);
+            eqn.add(cell, nb, theta * flux);
             eqn.addSource(cell, (1. - theta) * flux0 * (u0(nb.cell()) - u0(cell)));
         }
 
@@ -13,7 +13,7 @@ VectorFvmEquation axi::divSigma(Scalar mu, const ScalarFiniteVolumeField &p, Vec
             Scalar flux = mu * dot(nb.rc(), sf) / nb.rc().magSqr();
 
             eqn.add(cell, cell, -theta * flux);
-            eqn.add(cell, nb.cell(), theta * flux);
+            eqn.add(cell, nb, theta * flux);
             eqn.addSource(cell, -p(nb.face()) * sf + (1. - theta) * flux * (u0(nb.cell()) - u0(cell)));
         }
 
@@ -73,7 +73,7 @@ VectorFvmEquation axi::divSigma(const ScalarFiniteVolumeField &rho, const Scalar
             Scalar flux0 = mu0(nb.face()) * dot(nb.rc(), sf) / nb.rc().magSqr();
 
             eqn.add(cell, cell, -theta * flux);
-            eqn.add(cell, nb.cell(), theta * flux);
+            eqn.add(cell, nb, theta * flux);
             eqn.addSource(cell, -p(nb.face()) * sf * rho(cell) / rho(nb.face()) + (1. - theta) * flux0 * (u0(nb.cell()) - u0(cell)));
         }
 
@@ -6,21 +6,36 @@ FiniteVolumeEquation<Vector2D> fv::div(const VectorFiniteVolumeField &phiU,
 {
     FiniteVolumeEquation<Vector2D> eqn(u);
 
-    for (const Cell &cell: u.cells())
+    const CellGroup &cells = u.cells();
+
+    const FiniteVolumeGrid2D &grid = *u.grid();
+    const std::vector<Label> &linkPtr = grid.cellLinkPtr();
+    const std::vector<Label> &linkCells = grid.linkCells();
+    const std::vector<Label> &linkFaces = grid.linkFaces();
+    const std::vector<Vector2D> &linkNorms = grid.linkNorms();
+    const std::vector<Vector2D> &linkCellVecs = grid.linkCellVecs();
+    const std::vector<Vector2D> &linkFaceVecs = grid.linkFaceVecs();
+
+    bool unknownBoundary = false;
+
+#pragma omp parallel for reduction(||: unknownBoundary)
+    for (Label i = 0; i < cells.size(); ++i)
     {
-        for (const InteriorLink &nb: cell.neighbours())
+        const Cell &cell = cells[i];
+
+        for (Label j = linkPtr[cell.id()]; j < linkPtr[cell.id() + 1]; ++j)
         {
-            Scalar flux = dot(phiU(nb.face()), nb.outwardNorm());
+            Scalar flux = dot(phiU.faces()[linkFaces[j]], linkNorms[j]);
 
             if (flux > 0.)
             {
                 eqn.add(cell, cell, flux);
-                eqn.addSource(cell, flux * dot(gradU(cell), nb.rFaceVec()));
+                eqn.addSource(cell, flux * dot(gradU(cell), linkFaceVecs[j]));
             }
             else
             {
-                eqn.add(cell, nb.cell(), flux);
-                eqn.addSource(cell, flux * dot(gradU(nb.cell()), nb.face().centroid() - nb.cell().centroid()));
+                eqn.addLink(cell, j, flux);
+                eqn.addSource(cell, flux * dot(gradU(linkCells[j]), linkFaceVecs[j] - linkCellVecs[j]));
             }
         }
 
@@ -43,10 +58,14 @@ FiniteVolumeEquation<Vector2D> fv::div(const VectorFiniteVolumeField &phiU,
                 break;
 
             default:
-                throw Exception("fv", "div", "unrecognized or unspecified boundary type.");
+                unknownBoundary = true;
             }
         }
     }
 
+    //- Exceptions cannot leave the parallel region
+    if (unknownBoundary)
+        throw Exception("fv", "div", "unrecognized or unspecified boundary type.");
+
     return eqn;
 }
@@ -16,17 +16,30 @@ namespace fv
         const VectorFiniteVolumeField &u0 = u.oldField(0);
         const FiniteVolumeField<T> &phi0 = phi.oldField(0);
 
-        for (const Cell &cell: phi.cells())
+        const CellGroup &cells = phi.cells();
+
+        const FiniteVolumeGrid2D &grid = *phi.grid();
+        const std::vector<Label> &linkPtr = grid.cellLinkPtr();
+        const std::vector<Label> &linkCells = grid.linkCells();
+        const std::vector<Label> &linkFaces = grid.linkFaces();
+        const std::vector<Vector2D> &linkNorms = grid.linkNorms();
+
+        bool unknownBoundary = false;
+
+#pragma omp parallel for reduction(||: unknownBoundary)
+        for (Label i = 0; i < cells.size(); ++i)
         {
-            for (const InteriorLink &nb: cell.neighbours())
+            const Cell &cell = cells[i];
+
+            for (Label j = linkPtr[cell.id()]; j < linkPtr[cell.id() + 1]; ++j)
             {
-                Scalar flux = dot(u(nb.face()), nb.outwardNorm());
-                Scalar flux0 = dot(u0(nb.face()), nb.outwardNorm());
+                Scalar flux = dot(u.faces()[linkFaces[j]], linkNorms[j]);
+                Scalar flux0 = dot(u0.faces()[linkFaces[j]], linkNorms[j]);
 
                 eqn.add(cell, cell, theta * std::max(flux, 0.));
-                eqn.add(cell, nb.cell(), theta * std::min(flux, 0.));
+                eqn.addLink(cell, j, theta * std::min(flux, 0.));
                 eqn.addSource(cell, (1. - theta) * std::max(flux0, 0.) * phi0(cell));
-                eqn.addSource(cell, (1. - theta) * std::min(flux0, 0.) * phi0(nb.cell()));
+                eqn.addSource(cell, (1. - theta) * std::min(flux0, 0.) * phi0(linkCells[j]));
             }
 
             for (const BoundaryLink &bd: cell.boundaries())
@@ -50,11 +63,15 @@ namespace fv
                         break;
 
                     default:
-                        throw Exception("fv", "div<T>", "unrecognized or unspecified boundary type.");
+                        unknownBoundary = true;
                 }
             }
         }
 
+        //- Exceptions cannot leave the parallel region
+        if (unknownBoundary)
+            throw Exception("fv", "div<T>", "unrecognized or unspecified boundary type.");
+
         return eqn;
     }
 
@@ -67,20 +84,32 @@ namespace fv
         const VectorFiniteVolumeField &u0 = u.oldField(0);
         const FiniteVolumeField<T> &phi0 = phi.oldField(0);
 
-        for (const Cell &cell: phi.cells())
+        const CellGroup &cells = phi.cells();
+
+        const FiniteVolumeGrid2D &grid = *phi.grid();
+        const std::vector<Label> &linkPtr = grid.cellLinkPtr();
+        const std::vector<Label> &linkCells = grid.linkCells();
+        const std::vector<Label> &linkFaces = grid.linkFaces();
+        const std::vector<Vector2D> &linkNorms = grid.linkNorms();
+        const std::vector<Scalar> &linkWeights = grid.linkWeights();
+
+        bool unknownBoundary = false;
+
+#pragma omp parallel for reduction(||: unknownBoundary)
+        for (Label i = 0; i < cells.size(); ++i)
         {
-            for (const InteriorLink &nb: cell.neighbours())
+            const Cell &cell = cells[i];
+
+            for (Label j = linkPtr[cell.id()]; j < linkPtr[cell.id() + 1]; ++j)
             {
-                Scalar flux = theta * dot(u(nb.face()), nb.outwardNorm());
-                Scalar flux0 = (1. - theta) * dot(u0(nb.face()), nb.outwardNorm());
+                Scalar flux = theta * dot(u.faces()[linkFaces[j]], linkNorms[j]);
+                Scalar flux0 = (1. - theta) * dot(u0.faces()[linkFaces[j]], linkNorms[j]);
 
-                Scalar lc = (nb.face().centroid() - cell.centroid()).mag();
-                Scalar ln = (nb.face().centroid() - nb.cell().centroid()).mag();
-                Scalar g = ln / (lc + ln);
+                Scalar g = linkWeights[j];
 
                 eqn.add(cell, cell, g * flux);
-                eqn.add(cell, nb.cell(), (1. - g) * flux);
-                eqn.addSource(cell, flux0 * (g * phi0(cell) + (1. - g) * phi0(nb.cell())));
+                eqn.addLink(cell, j, (1. - g) * flux);
+                eqn.addSource(cell, flux0 * (g * phi0(cell) + (1. - g) * phi0(linkCells[j])));
             }
 
             for (const BoundaryLink &bd: cell.boundaries())
@@ -104,11 +133,15 @@ namespace fv
                         break;
 
                     default:
-                        throw Exception("fv", "divc<T>", "unrecognized or unspecified boundary type.");
+                        unknownBoundary = true;
                 }
             }
         }
 
+        //- Exceptions cannot leave the parallel region
+        if (unknownBoundary)
+            throw Exception("fv", "divc<T>", "unrecognized or unspecified boundary type.");
+
         return eqn;
     }
 
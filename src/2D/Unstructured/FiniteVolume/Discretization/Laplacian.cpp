@@ -9,14 +9,27 @@ FiniteVolumeEquation<Vector2D> laplacian(Scalar gamma, VectorFiniteVolumeField &
     FiniteVolumeEquation<Vector2D> eqn(phi);
     const VectorFiniteVolumeField &phi0 = phi.oldField(0);
 
-    for (const Cell &cell: phi.cells())
+    const CellGroup &cells = phi.cells();
+
+    const FiniteVolumeGrid2D &grid = *phi.grid();
+    const std::vector<Label> &linkPtr = grid.cellLinkPtr();
+    const std::vector<Label> &linkCells = grid.linkCells();
+    const std::vector<Vector2D> &linkNorms = grid.linkNorms();
+    const std::vector<Vector2D> &linkCellVecs = grid.linkCellVecs();
+
+    bool unknownBoundary = false;
+
+#pragma omp parallel for reduction(||: unknownBoundary)
+    for (Label i = 0; i < cells.size(); ++i)
     {
-        for (const InteriorLink &nb: cell.neighbours())
+        const Cell &cell = cells[i];
+
+        for (Label j = linkPtr[cell.id()]; j < linkPtr[cell.id() + 1]; ++j)
         {
-            Scalar coeff = gamma * dot(nb.rCellVec(), nb.outwardNorm()) / nb.rCellVec().magSqr();
-            eqn.add(cell, nb.cell(), theta * coeff);
+            Scalar coeff = gamma * dot(linkCellVecs[j], linkNorms[j]) / linkCellVecs[j].magSqr();
+            eqn.addLink(cell, j, theta * coeff);
             eqn.add(cell, cell, theta * -coeff);
-            eqn.addSource(cell, (1. - theta) * coeff * (phi0(nb.cell()) - phi0(cell)));
+            eqn.addSource(cell, (1. - theta) * coeff * (phi0(linkCells[j]) - phi0(cell)));
         }
 
         for (const BoundaryLink &bd: cell.boundaries())
@@ -56,11 +69,15 @@ FiniteVolumeEquation<Vector2D> laplacian(Scalar gamma, VectorFiniteVolumeField &
             }
 
             default:
-                throw Exception("fv", "laplacian<Vector2D>", "unrecognized or unspecified boundary type.");
+                unknownBoundary = true;
             }
         }
     }
 
+    //- Exceptions cannot leave the parallel region
+    if (unknownBoundary)
+        throw Exception("fv", "laplacian<Vector2D>", "unrecognized or unspecified boundary type.");
+
     return eqn;
 }
 
@@ -73,15 +90,29 @@ FiniteVolumeEquation<Vector2D> laplacian(const ScalarFiniteVolumeField &gamma,
     const ScalarFiniteVolumeField &gamma0 = gamma.oldField(0);
     const VectorFiniteVolumeField &phi0 = phi.oldField(0);
 
-    for (const Cell &cell: phi.cells())
+    const CellGroup &cells = phi.cells();
+
+    const FiniteVolumeGrid2D &grid = *phi.grid();
+    const std::vector<Label> &linkPtr = grid.cellLinkPtr();
+    const std::vector<Label> &linkCells = grid.linkCells();
+    const std::vector<Label> &linkFaces = grid.linkFaces();
+    const std::vector<Vector2D> &linkNorms = grid.linkNorms();
+    const std::vector<Vector2D> &linkCellVecs = grid.linkCellVecs();
+
+    bool unknownBoundary = false;
+
+#pragma omp parallel for reduction(||: unknownBoundary)
+    for (Label i = 0; i < cells.size(); ++i)
     {
-        for (const InteriorLink &nb: cell.neighbours())
+        const Cell &cell = cells[i];
+
+        for (Label j = linkPtr[cell.id()]; j < linkPtr[cell.id() + 1]; ++j)
         {
-            Scalar coeff = gamma(nb.face()) * dot(nb.rCellVec(), nb.outwardNorm()) / nb.rCellVec().magSqr();
-            Scalar coeff0 = gamma0(nb.face()) * dot(nb.rCellVec(), nb.outwardNorm()) / nb.rCellVec().magSqr();
+            Scalar coeff = gamma.faces()[linkFaces[j]] * dot(linkCellVecs[j], linkNorms[j]) / linkCellVecs[j].magSqr();
+            Scalar coeff0 = gamma0.faces()[linkFaces[j]] * dot(linkCellVecs[j], linkNorms[j]) / linkCellVecs[j].magSqr();
             eqn.add(cell, cell, theta * -coeff);
-            eqn.add(cell, nb.cell(), theta * coeff);
-            eqn.addSource(cell, (1. - theta) * coeff0 * (phi0(nb.cell()) - phi0(cell)));
+            eqn.addLink(cell, j, theta * coeff);
+            eqn.addSource(cell, (1. - theta) * coeff0 * (phi0(linkCells[j]) - phi0(cell)));
         }
 
         for (const BoundaryLink &bd: cell.boundaries())
@@ -110,11 +141,15 @@ FiniteVolumeEquation<Vector2D> laplacian(const ScalarFiniteVolumeField &gamma,
                 break;
 
             default:
-                throw Exception("fv", "laplacian<Vector2D>", "unrecognized or unspecified boundary type.");
+                unknownBoundary = true;
             }
         }
     }
 
+    //- Exceptions cannot leave the parallel region
+    if (unknownBoundary)
+        throw Exception("fv", "laplacian<Vector2D>", "unrecognized or unspecified boundary type.");
+
     return eqn;
 }
 
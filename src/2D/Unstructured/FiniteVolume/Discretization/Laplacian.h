@@ -11,14 +11,27 @@ FiniteVolumeEquation<T> laplacian(Scalar gamma, FiniteVolumeField<T> &phi, Scala
     FiniteVolumeEquation<T> eqn(phi);
     const FiniteVolumeField<T> &phi0 = phi.oldField(0);
 
-    for (const Cell &cell: phi.cells())
+    const CellGroup &cells = phi.cells();
+
+    const FiniteVolumeGrid2D &grid = *phi.grid();
+    const std::vector<Label> &linkPtr = grid.cellLinkPtr();
+    const std::vector<Label> &linkCells = grid.linkCells();
+    const std::vector<Vector2D> &linkNorms = grid.linkNorms();
+    const std::vector<Vector2D> &linkCellVecs = grid.linkCellVecs();
+
+    bool unknownBoundary = false;
+
+#pragma omp parallel for reduction(||: unknownBoundary)
+    for (Label i = 0; i < cells.size(); ++i)
     {
-        for (const InteriorLink &nb: cell.neighbours())
+        const Cell &cell = cells[i];
+
+        for (Label j = linkPtr[cell.id()]; j < linkPtr[cell.id() + 1]; ++j)
         {
-            Scalar coeff = gamma * dot(nb.rCellVec(), nb.outwardNorm()) / nb.rCellVec().magSqr();
-            eqn.add(cell, nb.cell(), theta * coeff);
+            Scalar coeff = gamma * dot(linkCellVecs[j], linkNorms[j]) / linkCellVecs[j].magSqr();
+            eqn.addLink(cell, j, theta * coeff);
             eqn.add(cell, cell, theta * -coeff);
-            eqn.addSource(cell, (1. - theta) * coeff * (phi0(nb.cell()) - phi0(cell)));
+            eqn.addSource(cell, (1. - theta) * coeff * (phi0(linkCells[j]) - phi0(cell)));
         }
 
         for (const BoundaryLink &bd: cell.boundaries())
@@ -38,11 +51,15 @@ FiniteVolumeEquation<T> laplacian(Scalar gamma, FiniteVolumeField<T> &phi, Scala
                 break;
 
             default:
-                throw Exception("fv", "laplacian<T>", "unrecognized or unspecified boundary type.");
+                unknownBoundary = true;
             }
         }
     }
 
+    //- Exceptions cannot leave the parallel region
+    if (unknownBoundary)
+        throw Exception("fv", "laplacian<T>", "unrecognized or unspecified boundary type.");
+
     return eqn;
 }
 
@@ -51,12 +68,24 @@ FiniteVolumeEquation<T> laplacian(Scalar gamma, FiniteVolumeField<T> &phi)
 {
     FiniteVolumeEquation<T> eqn(phi);
 
-    for (const Cell &cell: phi.cells())
+    const CellGroup &cells = phi.cells();
+
+    const FiniteVolumeGrid2D &grid = *phi.grid();
+    const std::vector<Label> &linkPtr = grid.cellLinkPtr();
+    const std::vector<Vector2D> &linkNorms = grid.linkNorms();
+    const std::vector<Vector2D> &linkCellVecs = grid.linkCellVecs();
+
+    bool unknownBoundary = false;
+
+#pragma omp parallel for reduction(||: unknownBoundary)
+    for (Label i = 0; i < cells.size(); ++i)
     {
-        for (const InteriorLink &nb: cell.neighbours())
+        const Cell &cell = cells[i];
+
+        for (Label j = linkPtr[cell.id()]; j < linkPtr[cell.id() + 1]; ++j)
         {
-            Scalar coeff = gamma * dot(nb.rCellVec(), nb.outwardNorm()) / nb.rCellVec().magSqr();
-            eqn.add(cell, nb.cell(), coeff);
+            Scalar coeff = gamma * dot(linkCellVecs[j], linkNorms[j]) / linkCellVecs[j].magSqr();
+            eqn.addLink(cell, j, coeff);
             eqn.add(cell, cell, -coeff);
         }
 
@@ -76,11 +105,15 @@ FiniteVolumeEquation<T> laplacian(Scalar gamma, FiniteVolumeField<T> &phi)
                 break;
 
             default:
-                throw Exception("fv", "laplacian<T>", "unrecognized or unspecified boundary type.");
+                unknownBoundary = true;
             }
         }
     }
 
+    //- Exceptions cannot leave the parallel region
+    if (unknownBoundary)
+        throw Exception("fv", "laplacian<T>", "unrecognized or unspecified boundary type.");
+
     return eqn;
 }
 
@@ -93,15 +126,29 @@ FiniteVolumeEquation<T> laplacian(const ScalarFiniteVolumeField &gamma,
     const ScalarFiniteVolumeField &gamma0 = gamma.oldField(0);
     const FiniteVolumeField<T> &phi0 = phi.oldField(0);
 
-    for (const Cell &cell: phi.cells())
+    const CellGroup &cells = phi.cells();
+
+    const FiniteVolumeGrid2D &grid = *phi.grid();
+    const std::vector<Label> &linkPtr = grid.cellLinkPtr();
+    const std::vector<Label> &linkCells = grid.linkCells();
+    const std::vector<Label> &linkFaces = grid.linkFaces();
+    const std::vector<Vector2D> &linkNorms = grid.linkNorms();
+    const std::vector<Vector2D> &linkCellVecs = grid.linkCellVecs();
+
+    bool unknownBoundary = false;
+
+#pragma omp parallel for reduction(||: unknownBoundary)
+    for (Label i = 0; i < cells.size(); ++i)
     {
-        for (const InteriorLink &nb: cell.neighbours())
+        const Cell &cell = cells[i];
+
+        for (Label j = linkPtr[cell.id()]; j < linkPtr[cell.id() + 1]; ++j)
         {
-            Scalar coeff = gamma(nb.face()) * dot(nb.rCellVec(), nb.outwardNorm()) / nb.rCellVec().magSqr();
-            Scalar coeff0 = gamma0(nb.face()) * dot(nb.rCellVec(), nb.outwardNorm()) / nb.rCellVec().magSqr();
+            Scalar coeff = gamma.faces()[linkFaces[j]] * dot(linkCellVecs[j], linkNorms[j]) / linkCellVecs[j].magSqr();
+            Scalar coeff0 = gamma0.faces()[linkFaces[j]] * dot(linkCellVecs[j], linkNorms[j]) / linkCellVecs[j].magSqr();
             eqn.add(cell, cell, theta * -coeff);
-            eqn.add(cell, nb.cell(), theta * coeff);
-            eqn.addSource(cell, (1. - theta) * coeff0 * (phi0(nb.cell()) - phi0(cell)));
+            eqn.addLink(cell, j, theta * coeff);
+            eqn.addSource(cell, (1. - theta) * coeff0 * (phi0(linkCells[j]) - phi0(cell)));
         }
 
         for (const BoundaryLink &bd: cell.boundaries())
@@ -122,11 +169,15 @@ FiniteVolumeEquation<T> laplacian(const ScalarFiniteVolumeField &gamma,
                 break;
 
             default:
-                throw Exception("fv", "laplacian<T>", "unrecognized or unspecified boundary type.");
+                unknownBoundary = true;
             }
         }
     }
 
+    //- Exceptions cannot leave the parallel region
+    if (unknownBoundary)
+        throw Exception("fv", "laplacian<T>", "unrecognized or unspecified boundary type.");
+
     return eqn;
 }
 
@@ -136,13 +187,26 @@ FiniteVolumeEquation<T> laplacian(const ScalarFiniteVolumeField &gamma,
 {
     FiniteVolumeEquation<T> eqn(phi);
 
-    for (const Cell &cell: phi.cells())
+    const CellGroup &cells = phi.cells();
+
+    const FiniteVolumeGrid2D &grid = *phi.grid();
+    const std::vector<Label> &linkPtr = grid.cellLinkPtr();
+    const std::vector<Label> &linkFaces = grid.linkFaces();
+    const std::vector<Vector2D> &linkNorms = grid.linkNorms();
+    const std::vector<Vector2D> &linkCellVecs = grid.linkCellVecs();
+
+    bool unknownBoundary = false;
+
+#pragma omp parallel for reduction(||: unknownBoundary)
+    for (Label i = 0; i < cells.size(); ++i)
     {
-        for (const InteriorLink &nb: cell.neighbours())
+        const Cell &cell = cells[i];
+
+        for (Label j = linkPtr[cell.id()]; j < linkPtr[cell.id() + 1]; ++j)
         {
-            Scalar coeff = gamma(nb.face()) * dot(nb.rCellVec(), nb.outwardNorm()) / nb.rCellVec().magSqr();
+            Scalar coeff = gamma.faces()[linkFaces[j]] * dot(linkCellVecs[j], linkNorms[j]) / linkCellVecs[j].magSqr();
             eqn.add(cell, cell, -coeff);
-            eqn.add(cell, nb.cell(), coeff);
+            eqn.addLink(cell, j, coeff);
         }
 
         for (const BoundaryLink &bd: cell.boundaries())
@@ -161,11 +225,15 @@ FiniteVolumeEquation<T> laplacian(const ScalarFiniteVolumeField &gamma,
                 break;
 
             default:
-                throw Exception("fv", "laplacian<T>", "unrecognized or unspecified boundary type.");
+                unknownBoundary = true;
             }
         }
     }
 
+    //- Exceptions cannot leave the parallel region
+    if (unknownBoundary)
+        throw Exception("fv", "laplacian<T>", "unrecognized or unspecified boundary type.");
+
     return eqn;
 }
 }
@@ -2,6 +2,181 @@
 #include "FiniteVolume/Field/ScalarGradient.h"
 #include "Math/Algorithm.h"
 
-namespace plic {
+namespace
+{
+    const Scalar eps = 1e-8;
 
+    //- Sutherland-Hodgman clip of a closed ring to the half plane dot(x, m) <= c, the result is left open
+    std::vector<Point2D> clip(const std::vector<Point2D> &vertices, const Vector2D &m, Scalar c)
+    {
+        std::vector<Point2D> result;
+
+        for (int i = 0; i < (int) vertices.size() - 1; ++i)
+        {
+            const Point2D &a = vertices[i];
+            const Point2D &b = vertices[i + 1];
+
+            Scalar da = dot(a, m) - c;
+            Scalar db = dot(b, m) - c;
+
+            if (da <= 0.)
+                result.push_back(a);
+
+            if ((da < 0. && db > 0.) || (da > 0. && db < 0.))
+                result.push_back(a + da / (da - db) * (b - a));
+        }
+
+        return result;
+    }
+
+    Scalar area(const std::vector<Point2D> &pts)
+    {
+        Scalar a = 0.;
+
+        for (int i = 0; i < pts.size(); ++i)
+            a += cross(pts[i], pts[(i + 1) % pts.size()]);
+
+        return std::abs(a) / 2.;
+    }
+
+    Scalar area(const std::vector<Polygon> &pgns)
+    {
+        Scalar a = 0.;
+
+        for (const Polygon &pgn: pgns)
+            a += pgn.area();
+
+        return a;
+    }
+}
+
+Polygon plic::interfacePolygon(const Cell &cell, Scalar gamma, const Vector2D &m)
+{
+    if (gamma <= eps)
+        return Polygon();
+    else if (gamma >= 1. - eps)
+        return cell.shape();
+
+    const std::vector<Point2D> &vertices = cell.shape().vertices();
+    Vector2D n = m.unitVec();
+
+    auto bounds = std::minmax_element(vertices.begin(), vertices.end(), [&n](const Point2D &a, const Point2D &b)
+    {
+        return dot(a, n) < dot(b, n);
+    });
+
+    //- The enclosed area increases monotonically with the line constant
+    Scalar c = bisectionSearch(std::make_pair(dot(*bounds.first, n), dot(*bounds.second, n)),
+                               [&vertices, &n, &cell, gamma](Scalar c)
+    {
+        return area(clip(vertices, n, c)) - gamma * cell.volume();
+    }, eps * cell.volume(), 100);
+
+    std::vector<Point2D> pts = clip(vertices, n, c);
+
+    return Polygon(pts.begin(), pts.end());
+}
+
+std::vector<Scalar> plic::faceFractions(const VectorFiniteVolumeField &u,
+                                        const ScalarFiniteVolumeField &gamma,
+                                        const VectorFiniteVolumeField &gradGamma,
+                                        Scalar timeStep)
+{
+    const FiniteVolumeGrid2D &grid = *gamma.grid();
+
+    std::vector<Scalar> fractions(grid.faces().size(), 0.);
+    std::vector<Polygon> pgns(grid.cells().size());
+    std::vector<bool> reconstructed(grid.cells().size(), false);
+
+    for (const Face &face: grid.interiorFaces())
+    {
+        Scalar flux = dot(u(face), face.outwardNorm(face.lCell().centroid()));
+        const Cell &donor = flux > 0. ? face.lCell() : face.rCell();
+
+        Scalar gammaD = clamp(gamma(donor), 0., 1.);
+        Vector2D m = -gradGamma(donor);
+
+        fractions[face.id()] = gammaD;
+
+        if (gammaD <= eps || gammaD >= 1. - eps || m.magSqr() == 0. || flux == 0.)
+            continue;
+
+        if (!reconstructed[donor.id()])
+        {
+            pgns[donor.id()] = interfacePolygon(donor, gammaD, m);
+            reconstructed[donor.id()] = true;
+        }
+
+        //- Region swept through the face, traced back along the face velocity and clipped to the donor
+        Vector2D dx = u(face) * timeStep;
+        Polygon fluxPgn({face.lNode(), face.rNode(), face.rNode() - dx, face.lNode() - dx});
+
+        Scalar sweptArea = area(intersection(fluxPgn, donor.shape()));
+
+        if (sweptArea > eps * donor.volume())
+            fractions[face.id()] = clamp(area(intersection(fluxPgn, pgns[donor.id()])) / sweptArea, 0., 1.);
+    }
+
+    return fractions;
+}
+
+void plic::computeMomentumFlux(Scalar rho1,
+                               Scalar rho2,
+                               const VectorFiniteVolumeField &u,
+                               const ScalarFiniteVolumeField &gamma,
+                               const std::vector<Scalar> &faceFractions,
+                               VectorFiniteVolumeField &rhoU)
+{
+    rhoU.computeInteriorFaces([rho1, rho2, &u, &faceFractions](const Face &f) {
+        return (rho1 + faceFractions[f.id()] * (rho2 - rho1)) * u(f);
+    });
+
+    rhoU.computeBoundaryFaces([rho1, rho2, &u, &gamma](const Face &f) {
+        return (rho1 + clamp(gamma(f), 0., 1.) * (rho2 - rho1)) * u(f);
+    });
+}
+
+FiniteVolumeEquation<Scalar> plic::div(const VectorFiniteVolumeField &u,
+                                       ScalarFiniteVolumeField &gamma,
+                                       const std::vector<Scalar> &faceFractions)
+{
+    FiniteVolumeEquation<Scalar> eqn(gamma);
+    const ScalarFiniteVolumeField &gamma0 = gamma.oldField(0);
+
+    for (const Cell &cell: gamma.cells())
+    {
+        for (const InteriorLink &nb: cell.neighbours())
+            eqn.addSource(cell, dot(u(nb.face()), nb.outwardNorm()) * faceFractions[nb.face().id()]);
+
+        for (const BoundaryLink &bd: cell.boundaries())
+        {
+            Scalar flux = dot(u(bd.face()), bd.outwardNorm());
+            switch (gamma.boundaryType(bd.face()))
+            {
+            case ScalarFiniteVolumeField::FIXED:
+                eqn.addSource(cell, flux * gamma0(bd.face()));
+                break;
+
+            case ScalarFiniteVolumeField::NORMAL_GRADIENT:
+                eqn.addSource(cell, flux * gamma0(cell));
+                break;
+
+            case ScalarFiniteVolumeField::SYMMETRY:
+                break;
+
+            default:
+                throw Exception("plic", "div", "unrecognized or unspecified boundary type.");
+            }
+        }
+    }
+
+    return eqn;
+}
+
+FiniteVolumeEquation<Scalar> plic::div(const VectorFiniteVolumeField &u,
+                                       const VectorFiniteVolumeField &gradGamma,
+                                       ScalarFiniteVolumeField &gamma,
+                                       Scalar timeStep)
+{
+    return div(u, gamma, faceFractions(u, gamma.oldField(0), gradGamma, timeStep));
 }
@@ -5,18 +5,31 @@
 
 namespace plic {
 
+    //- Part of the cell occupied by gamma = 1, bounded by a line with normal m pointing out of it
+    Polygon interfacePolygon(const Cell &cell, Scalar gamma, const Vector2D &m);
+
+    //- Fraction of gamma = 1 in the region swept through each interior face in one time step, using Youngs' normal
+    std::vector<Scalar> faceFractions(const VectorFiniteVolumeField &u,
+                                      const ScalarFiniteVolumeField &gamma,
+                                      const VectorFiniteVolumeField &gradGamma,
+                                      Scalar timeStep);
+
+    void computeMomentumFlux(Scalar rho1,
+                             Scalar rho2,
+                             const VectorFiniteVolumeField &u,
+                             const ScalarFiniteVolumeField &gamma,
+                             const std::vector<Scalar> &faceFractions,
+                             VectorFiniteVolumeField &rhoU);
+
+    //- Explicit geometric advection, the previous time step of gamma must have been saved
+    FiniteVolumeEquation<Scalar> div(const VectorFiniteVolumeField &u,
+                                     ScalarFiniteVolumeField &gamma,
+                                     const std::vector<Scalar> &faceFractions);
+
     FiniteVolumeEquation<Scalar> div(const VectorFiniteVolumeField& u,
                          const VectorFiniteVolumeField& gradGamma,
                          ScalarFiniteVolumeField& gamma,
                          Scalar timeStep);
-
-/*
-FiniteVolumeEquation<ScalarFiniteVolumeField> div(const VectorFiniteVolumeField &u, const VectorFiniteVolumeField& gradGamma, ScalarFiniteVolumeField &field, Scalar timeStep,
-                                      std::vector<Polygon>& plicPolygons);
-
-Polygon computeInterfacePolygon(const Cell& cell, Scalar &gamma, const Vector2D& normal);
-Polygon computeFluxPolygon(const BoundaryLink &link, const Vector2D& uf, Scalar timeStep, int componentNo);
-*/
 }
 
 #endif
@@ -6,12 +6,20 @@ Vector src::div(const VectorFiniteVolumeField &field, const CellGroup &cells)
 {
     Vector divU(field.grid()->localCells().size());
 
-    for (const Cell &cell: cells)
+    const FiniteVolumeGrid2D &grid = *field.grid();
+    const std::vector<Label> &linkPtr = grid.cellLinkPtr();
+    const std::vector<Label> &linkFaces = grid.linkFaces();
+    const std::vector<Vector2D> &linkNorms = grid.linkNorms();
+
+#pragma omp parallel for
+    for (Label i = 0; i < cells.size(); ++i)
     {
+        const Cell &cell = cells[i];
+
         Scalar divUc = 0.;
 
-        for (const InteriorLink &nb: cell.neighbours())
-            divUc += dot(field(nb.face()), nb.outwardNorm());
+        for (Label j = linkPtr[cell.id()]; j < linkPtr[cell.id() + 1]; ++j)
+            divUc += dot(field.faces()[linkFaces[j]], linkNorms[j]);
 
         for (const BoundaryLink &bd: cell.boundaries())
             divUc += dot(field(bd.face()), bd.outwardNorm());
@@ -32,14 +40,25 @@ Vector src::laplacian(Scalar gamma,
 {
     Vector lapPhi(phi.grid()->localCells().size());
 
-    for (const Cell &cell: phi.cells())
+    const CellGroup &cells = phi.cells();
+
+    const FiniteVolumeGrid2D &grid = *phi.grid();
+    const std::vector<Label> &linkPtr = grid.cellLinkPtr();
+    const std::vector<Label> &linkCells = grid.linkCells();
+    const std::vector<Vector2D> &linkNorms = grid.linkNorms();
+    const std::vector<Vector2D> &linkCellVecs = grid.linkCellVecs();
+
+#pragma omp parallel for
+    for (Label i = 0; i < cells.size(); ++i)
     {
+        const Cell &cell = cells[i];
+
         Scalar tmp = 0.;
 
-        for (const InteriorLink &nb: cell.neighbours())
+        for (Label j = linkPtr[cell.id()]; j < linkPtr[cell.id() + 1]; ++j)
         {
-            Scalar coeff = gamma * dot(nb.rCellVec(), nb.outwardNorm()) / nb.rCellVec().magSqr();
-            tmp += (phi(nb.cell()) - phi(cell)) * coeff;
+            Scalar coeff = gamma * dot(linkCellVecs[j], linkNorms[j]) / linkCellVecs[j].magSqr();
+            tmp += (phi(linkCells[j]) - phi(cell)) * coeff;
         }
 
         for (const BoundaryLink &bd: cell.boundaries())
@@ -59,14 +78,26 @@ Vector src::laplacian(const ScalarFiniteVolumeField &gamma,
 {
     Vector lapPhi(2 * phi.grid()->localCells().size());
 
-    for (const Cell &cell: phi.cells())
+    const CellGroup &cells = phi.cells();
+
+    const FiniteVolumeGrid2D &grid = *phi.grid();
+    const std::vector<Label> &linkPtr = grid.cellLinkPtr();
+    const std::vector<Label> &linkCells = grid.linkCells();
+    const std::vector<Label> &linkFaces = grid.linkFaces();
+    const std::vector<Vector2D> &linkNorms = grid.linkNorms();
+    const std::vector<Vector2D> &linkCellVecs = grid.linkCellVecs();
+
+#pragma omp parallel for
+    for (Label i = 0; i < cells.size(); ++i)
     {
+        const Cell &cell = cells[i];
+
         Vector2D tmp = Vector2D(0., 0.);
 
-        for (const InteriorLink &nb: cell.neighbours())
+        for (Label j = linkPtr[cell.id()]; j < linkPtr[cell.id() + 1]; ++j)
         {
-            Scalar coeff = gamma(nb.face()) * dot(nb.rCellVec(), nb.outwardNorm()) / nb.rCellVec().magSqr();
-            tmp += (phi(nb.cell()) - phi(cell)) * coeff;
+            Scalar coeff = gamma.faces()[linkFaces[j]] * dot(linkCellVecs[j], linkNorms[j]) / linkCellVecs[j].magSqr();
+            tmp += (phi(linkCells[j]) - phi(cell)) * coeff;
         }
 
         for (const BoundaryLink &bd: cell.boundaries())
@@ -86,8 +117,11 @@ Vector src::src(const ScalarFiniteVolumeField &field)
 {
     Vector vec(field.grid()->localCells().size());
 
-    for(const Cell& cell: field.cells())
-        vec(field.indexMap()->local(cell, 0)) = field(cell) * cell.volume();
+    const CellGroup &cells = field.cells();
+
+#pragma omp parallel for
+    for (Label i = 0; i < cells.size(); ++i)
+        vec(field.indexMap()->local(cells[i], 0)) = field(cells[i]) * cells[i].volume();
 
     return vec;
 }
@@ -96,8 +130,13 @@ Vector src::src(const VectorFiniteVolumeField &field)
 {
     Vector vec(2 * field.grid()->localCells().size());
 
-    for(const Cell& cell: field.cells())
+    const CellGroup &cells = field.cells();
+
+#pragma omp parallel for
+    for (Label i = 0; i < cells.size(); ++i)
     {
+        const Cell &cell = cells[i];
+
         vec(field.indexMap()->local(cell, 0)) = field(cell).x * cell.volume();
         vec(field.indexMap()->local(cell, 1)) = field(cell).y * cell.volume();
     }
@@ -13,7 +13,7 @@ VectorFvmEquation fv::divSigma(Scalar mu, const ScalarFiniteVolumeField &p, Vect
         {
             Scalar coeff = mu * dot(nb.rc(), nb.sf()) / nb.rc().magSqr();
 
-            eqn.add(cell, nb.cell(), coeff * theta);
+            eqn.add(cell, nb, coeff * theta);
             eqn.add(cell, cell, -coeff * theta);
             eqn.addSource(cell, -p(nb.face()) * nb.sf() + coeff * (u0(nb.cell()) - u0(cell)) * (1. - theta));
         }
@@ -56,7 +56,7 @@ VectorFvmEquation fv::divSigma(const ScalarFiniteVolumeField &mu, const ScalarFi
         {
             Scalar coeff = mu(nb.face()) * dot(nb.rc(), nb.sf()) / nb.rc().magSqr();
 
-            eqn.add(cell, nb.cell(), coeff * theta);
+            eqn.add(cell, nb, coeff * theta);
             eqn.add(cell, cell, -coeff * theta);
 
             Tensor2D tau0 = mu(nb.face()) * outer(u0(nb.cell()) - u0(cell), nb.rc() / nb.rc().magSqr());
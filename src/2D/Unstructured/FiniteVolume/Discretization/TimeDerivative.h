@@ -11,8 +11,13 @@ namespace fv
         FiniteVolumeEquation<T> eqn(field);
         const FiniteVolumeField<T> &field0 = field.oldField(0);
 
-        for (const Cell &cell: field.cells())
+        const CellGroup &cells = field.cells();
+
+#pragma omp parallel for
+        for (Label i = 0; i < cells.size(); ++i)
         {
+            const Cell &cell = cells[i];
+
             eqn.add(cell, cell, rho * cell.volume() / timeStep);
             eqn.addSource(cell, -rho * cell.volume() * field0(cell) / timeStep);
         }
@@ -28,8 +33,13 @@ namespace fv
 
         FiniteVolumeEquation<T> eqn(field);
 
-        for (const Cell &cell: field.cells())
+        const CellGroup &cells = field.cells();
+
+#pragma omp parallel for
+        for (Label i = 0; i < cells.size(); ++i)
         {
+            const Cell &cell = cells[i];
+
             eqn.add(cell, cell, rho(cell) * cell.volume() / timeStep);
             eqn.addSource(cell, -rho0(cell) * cell.volume() * field0(cell) / timeStep);
         }
@@ -43,8 +53,13 @@ namespace fv
         FiniteVolumeEquation<T> eqn(field);
         const FiniteVolumeField<T> &field0 = field.oldField(0);
 
-        for (const Cell &cell: field.cells())
+        const CellGroup &cells = field.cells();
+
+#pragma omp parallel for
+        for (Label i = 0; i < cells.size(); ++i)
         {
+            const Cell &cell = cells[i];
+
             eqn.add(cell, cell, cell.volume() / timeStep);
             eqn.addSource(cell, -cell.volume() * field0(cell) / timeStep);
         }
@@ -58,8 +73,11 @@ namespace fv
         FiniteVolumeEquation<T> eqn(field);
         const FiniteVolumeField<T> &field0 = field.oldField(0);
 
-        for (const Cell &cell: cells)
+#pragma omp parallel for
+        for (Label i = 0; i < cells.size(); ++i)
         {
+            const Cell &cell = cells[i];
+
             eqn.add(cell, cell, cell.volume() / timeStep);
             eqn.addSource(cell, -cell.volume() * field0(cell) / timeStep);
         }
@@ -15,7 +15,7 @@ VectorFvmEquation fv::divTau(const ScalarFiniteVolumeField &mu, VectorFiniteVolu
             Scalar coeff = mu(nb.face()) * dot(nb.rCellVec(), nb.outwardNorm()) / nb.rCellVec().magSqr();
             Scalar coeff0 = mu0(nb.face()) * dot(nb.rCellVec(), nb.outwardNorm()) / nb.rCellVec().magSqr();
             eqn.add(cell, cell, theta * -coeff);
-            eqn.add(cell, nb.cell(), theta * coeff);
+            eqn.add(cell, nb, theta * coeff);
             eqn.addSource(cell, (1. - theta) * coeff0 * (u0(nb.cell()) - u0(cell)));
         }
 
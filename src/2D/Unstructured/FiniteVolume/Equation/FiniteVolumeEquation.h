@@ -5,7 +5,7 @@
 
 #include "System/Input.h"
 
-#include "Math/CrsEquation.h"
+#include "Math/CrsEquationSum.h"
 
 #include "FiniteVolumeGrid2D/FiniteVolumeGrid2D.h"
 #include "FiniteVolume/Field/ScalarFiniteVolumeField.h"
@@ -41,11 +41,19 @@ public:
 
     FiniteVolumeEquation<T> &operator =(CrsEquation &&rhs);
 
+    FiniteVolumeEquation<T> &operator =(CrsEquationSum &&rhs);
+
     //- Add/set/get coefficients
     void set(const Cell &cell, const Cell &nb, Scalar val);
 
     void add(const Cell &cell, const Cell &nb, Scalar val);
 
+    //- Add a face neighbour coefficient directly into its slot of the index map sparsity pattern
+    void add(const Cell &cell, const InteriorLink &nb, Scalar val);
+
+    //- Same as above, but the neighbour is given by its index into the flat link arrays of the grid
+    void addLink(const Cell &cell, Label link, Scalar val);
+
     void scale(const Cell &cell, Scalar val);
 
     template<class T2>
@@ -100,6 +108,13 @@ protected:
 
     void mapFromSparseSolver();
 
+    //- Extracts the single index system shared by all components if the blocks of each index are identical and
+    //- uncoupled, only available for vector equations
+    bool segregate(const IndexMap &idxMap,
+                   std::vector<Index> &rowPtr,
+                   std::vector<Index> &colInd,
+                   std::vector<Scalar> &vals) const;
+
     Size getRank() const;
 
     FiniteVolumeField<T> &field_;
@@ -40,10 +40,16 @@ FiniteVolumeEquation<T> &FiniteVolumeEquation<T>::operator =(const CrsEquation &
 template<class T>
 FiniteVolumeEquation<T> &FiniteVolumeEquation<T>::operator =(CrsEquation &&rhs)
 {
-    CrsEquation::operator =(rhs);
+    CrsEquation::operator =(std::move(rhs));
     return *this;
 }
 
+template<class T>
+FiniteVolumeEquation<T> &FiniteVolumeEquation<T>::operator =(CrsEquationSum &&rhs)
+{
+    return operator =(rhs.evaluate());
+}
+
 template<class T>
 void FiniteVolumeEquation<T>::configureSparseSolver(const Input &input, const Communicator &comm)
 {
@@ -84,3 +90,7 @@ Scalar FiniteVolumeEquation<T>::solve()
 
     return solver_->error();
 }
+
+//- Solves the x and y components as one system with two right-hand sides when their blocks are identical
+template<>
+Scalar FiniteVolumeEquation<Vector2D>::solve();
@@ -1,4 +1,5 @@
 #include <numeric>
+#include <algorithm>
 
 #include "IndexMap.h"
 
@@ -20,8 +21,13 @@ void IndexMap::update(const FiniteVolumeGrid2D &grid)
 
     std::vector<Size> nLocalActiveCells = grid.comm().allGather(grid.localCells().size());
 
-    ownershipRange_.first = nIndices_ * std::accumulate(nLocalActiveCells.begin(), nLocalActiveCells.begin() + grid.comm().rank(), 0);
-    ownershipRange_.second = ownershipRange_.first + nIndices_ * nLocalActiveCells[grid.comm().rank()];
+    cellOffsets_.assign(1, 0);
+
+    for (Size nCells: nLocalActiveCells)
+        cellOffsets_.push_back(cellOffsets_.back() + nCells);
+
+    ownershipRange_.first = nIndices_ * cellOffsets_[grid.comm().rank()];
+    ownershipRange_.second = nIndices_ * cellOffsets_[grid.comm().rank() + 1];
 
     Index localIndex = 0;
 
@@ -34,4 +40,47 @@ void IndexMap::update(const FiniteVolumeGrid2D &grid)
 
     //- Communicate global indices to other procs
     grid.sendMessages(globalIndices_, nIndices_);
+
+    //- Build the sparsity pattern once the global indices of the halo cells are known
+    rowPtr_.assign(1, 0);
+    colInd_.clear();
+
+    for (Size indexNo = 0; indexNo < nIndices_; ++indexNo)
+        for (const Cell &cell: grid.localCells())
+        {
+            colInd_.push_back(global(cell, indexNo));
+
+            for (const InteriorLink &nb: cell.neighbours())
+                colInd_.push_back(global(nb.cell(), indexNo));
+
+            if (ibStencils_)
+                for (const CellLink &dg: cell.diagonals())
+                    colInd_.push_back(global(dg.cell(), indexNo));
+
+            //- Boundary conditions such as symmetry couple the indices of a boundary cell, so the slots are reserved
+            //- here and the parallel assembly loops never have to grow a row
+            if (ibStencils_ || !cell.boundaries().empty())
+                for (Size otherIndexNo = 0; otherIndexNo < nIndices_; ++otherIndexNo)
+                    if (otherIndexNo != indexNo)
+                        colInd_.push_back(global(cell, otherIndexNo));
+
+            rowPtr_.push_back(colInd_.size());
+        }
+}
+
+void IndexMap::reserveIbStencils(const FiniteVolumeGrid2D &grid)
+{
+    ibStencils_ = true;
+    update(grid);
+}
+
+std::pair<Index, Label> IndexMap::split(Index globalIndex) const
+{
+    auto proc = std::upper_bound(cellOffsets_.begin(), cellOffsets_.end(), globalIndex,
+                                 [this](Index idx, Index offset) { return idx < nIndices_ * offset; }) - cellOffsets_.begin() - 1;
+
+    Index nCells = cellOffsets_[proc + 1] - cellOffsets_[proc];
+    Index localIndex = globalIndex - nIndices_ * cellOffsets_[proc];
+
+    return std::make_pair(cellOffsets_[proc] + localIndex % nCells, localIndex / nCells);
 }
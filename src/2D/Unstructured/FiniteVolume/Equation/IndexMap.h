@@ -22,12 +22,19 @@ public:
 
     void update(const FiniteVolumeGrid2D &grid);
 
+    //- Also reserves the columns reached by the least-squares immersed boundary stencils, which are the diagonal links
+    //- and the other indices of every cell, so that the pattern does not change as the immersed boundary moves
+    void reserveIbStencils(const FiniteVolumeGrid2D &grid);
+
     Index local(const Cell &cell, Label indexNo = 0) const
     { return localIndices_[indexNo * nCells_ + cell.id()]; }
 
     Index global(const Cell &cell, Label indexNo = 0) const
     { return globalIndices_[indexNo * nCells_ + cell.id()]; }
 
+    Index global(Label cellId, Label indexNo = 0) const
+    { return globalIndices_[indexNo * nCells_ + cellId]; }
+
     bool isActive(const Cell &cell) const
     { return globalIndices_[cell.id()] != -1; }
 
@@ -40,13 +47,32 @@ public:
     Index maxGlobalIndex() const
     { return ownershipRange_.second - 1; }
 
+    //- Splits a global index into the global index of its cell in a single index numbering and its index number
+    std::pair<Index, Label> split(Index globalIndex) const;
+
+    //- Sparsity pattern of the face stencil, ordered as the diagonal followed by each interior link of the cell, and
+    //- for boundary cells the other indices of the cell. Immersed boundary stencils add the diagonal links before the
+    //- other indices, which are then reserved for every cell
+    const std::vector<Index> &rowPtr() const
+    { return rowPtr_; }
+
+    const std::vector<Index> &colInd() const
+    { return colInd_; }
+
 private:
 
     Size nCells_, nIndices_;
 
+    bool ibStencils_ = false;
+
     std::pair<Index, Index> ownershipRange_;
 
+    //- Number of active cells on the procs preceding each proc
+    std::vector<Index> cellOffsets_;
+
     std::vector<Index> localIndices_, globalIndices_;
+
+    std::vector<Index> rowPtr_, colInd_;
 };
 
 #endif
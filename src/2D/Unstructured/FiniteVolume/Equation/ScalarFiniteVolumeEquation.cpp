@@ -3,7 +3,9 @@
 template<>
 FiniteVolumeEquation<Scalar>::FiniteVolumeEquation(ScalarFiniteVolumeField &field, const std::string &name, int nnz)
         :
-        CrsEquation(field.grid()->localCells().size(), nnz),
+        CrsEquation(field.indexMap() ?
+                      CrsEquation(field.indexMap()->rowPtr(), field.indexMap()->colInd(), nnz) :
+                      CrsEquation(field.grid()->localCells().size(), nnz)),
         name(name),
         field_(field)
 {
@@ -22,6 +24,26 @@ void FiniteVolumeEquation<Scalar>::add(const Cell &cell, const Cell &nb, Scalar
     addCoeff(field_.indexMap()->local(cell, 0), field_.indexMap()->global(nb, 0), val);
 }
 
+template<>
+void FiniteVolumeEquation<Scalar>::add(const Cell &cell, const InteriorLink &nb, Scalar val)
+{
+    addCoeffAt(field_.indexMap()->local(cell, 0),
+               1 + (&nb - cell.neighbours().data()),
+               field_.indexMap()->global(nb.cell(), 0),
+               val);
+}
+
+template<>
+void FiniteVolumeEquation<Scalar>::addLink(const Cell &cell, Label link, Scalar val)
+{
+    const FiniteVolumeGrid2D &grid = *field_.grid();
+
+    addCoeffAt(field_.indexMap()->local(cell, 0),
+               1 + link - grid.cellLinkPtr()[cell.id()],
+               field_.indexMap()->global(grid.linkCells()[link], 0),
+               val);
+}
+
 template<>
 void FiniteVolumeEquation<Scalar>::addSource(const Cell &cell, Scalar val)
 {
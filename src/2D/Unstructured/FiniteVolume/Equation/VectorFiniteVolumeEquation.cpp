@@ -5,7 +5,9 @@
 template<>
 FiniteVolumeEquation<Vector2D>::FiniteVolumeEquation(VectorFiniteVolumeField &field, const std::string &name, int nnz)
     :
-      CrsEquation(2 * field.grid()->localCells().size(), nnz),
+      CrsEquation(field.indexMap() ?
+                      CrsEquation(field.indexMap()->rowPtr(), field.indexMap()->colInd(), nnz) :
+                      CrsEquation(2 * field.grid()->localCells().size(), nnz)),
       name(name),
       field_(field)
 {
@@ -36,6 +38,39 @@ void FiniteVolumeEquation<Vector2D>::add(const Cell &cell, const Cell &nb, Scala
              val);
 }
 
+template<>
+void FiniteVolumeEquation<Vector2D>::add(const Cell &cell, const InteriorLink &nb, Scalar val)
+{
+    Size slot = 1 + (&nb - cell.neighbours().data());
+
+    addCoeffAt(field_.indexMap()->local(cell, 0),
+               slot,
+               field_.indexMap()->global(nb.cell(), 0),
+               val);
+
+    addCoeffAt(field_.indexMap()->local(cell, 1),
+               slot,
+               field_.indexMap()->global(nb.cell(), 1),
+               val);
+}
+
+template<>
+void FiniteVolumeEquation<Vector2D>::addLink(const Cell &cell, Label link, Scalar val)
+{
+    const FiniteVolumeGrid2D &grid = *field_.grid();
+    Size slot = 1 + link - grid.cellLinkPtr()[cell.id()];
+
+    addCoeffAt(field_.indexMap()->local(cell, 0),
+               slot,
+               field_.indexMap()->global(grid.linkCells()[link], 0),
+               val);
+
+    addCoeffAt(field_.indexMap()->local(cell, 1),
+               slot,
+               field_.indexMap()->global(grid.linkCells()[link], 1),
+               val);
+}
+
 template<>
 void FiniteVolumeEquation<Vector2D>::scale(const Cell &cell, Scalar val)
 {
@@ -166,6 +201,60 @@ void FiniteVolumeEquation<Vector2D>::relax(Scalar relaxationFactor)
 }
 
 //- Private
+template<>
+bool FiniteVolumeEquation<Vector2D>::segregate(const IndexMap &idxMap,
+                                                std::vector<Index> &rowPtr,
+                                                std::vector<Index> &colInd,
+                                                std::vector<Scalar> &vals) const
+{
+    Index nRows = field_.grid()->localCells().size();
+
+    rowPtr.assign(1, 0);
+    colInd.clear();
+    vals.clear();
+
+    //- The x and y rows of each cell must hold the same coefficients, with no x-y coupling
+    for (Index row = 0; row < nRows; ++row)
+    {
+        Index xBegin = rowPtr_[row], yBegin = rowPtr_[row + nRows];
+        Index nnz = rowPtr_[row + 1] - xBegin;
+
+        if (rowPtr_[row + nRows + 1] - yBegin != nnz)
+            return false;
+
+        for (Index j = 0; j < nnz; ++j)
+        {
+            Index xCol = colInd_[xBegin + j], yCol = colInd_[yBegin + j];
+
+            if (xCol < 0 || yCol < 0)
+            {
+                if (xCol != yCol)
+                    return false;
+
+                continue;
+            }
+
+            auto x = idxMap.split(xCol);
+            auto y = idxMap.split(yCol);
+
+            //- Reserved x-y coupling slots of boundary cells are skipped while they are unused
+            if (x.second == 1 && y.second == 0 && x.first == y.first
+                && vals_[xBegin + j] == 0. && vals_[yBegin + j] == 0.)
+                continue;
+
+            if (x.second != 0 || y.second != 1 || x.first != y.first || vals_[xBegin + j] != vals_[yBegin + j])
+                return false;
+
+            colInd.push_back(x.first);
+            vals.push_back(vals_[xBegin + j]);
+        }
+
+        rowPtr.push_back(colInd.size());
+    }
+
+    return true;
+}
+
 template<>
 void FiniteVolumeEquation<Vector2D>::mapFromSparseSolver()
 {
@@ -184,6 +273,55 @@ Size FiniteVolumeEquation<Vector2D>::getRank() const
     return 2 * field_.grid()->localCells().size();
 }
 
+template<>
+Scalar FiniteVolumeEquation<Vector2D>::solve()
+{
+    if (!solver_)
+        throw Exception("FiniteVolumeEquation<Vector2D>", "solve",
+                        "must allocate a SparseMatrixSolver object before attempting to solve.");
+
+    const IndexMap &idxMap = *field_.indexMap();
+    std::vector<Index> rowPtr, colInd;
+    std::vector<Scalar> vals;
+
+    if (solver_->supportsMultipleRhs() && segregate(idxMap, rowPtr, colInd, vals))
+    {
+        //- The rhs holds all x rows followed by all y rows, so it is already laid out as two vectors
+        solver_->setNumVectors(2);
+        solver_->setRank(field_.grid()->localCells().size());
+        solver_->set(rowPtr, colInd, vals);
+        solver_->setRhs(-rhs_);
+        solver_->solve();
+
+        for (const Cell &cell: field_.grid()->localCells())
+        {
+            field_(cell).x = solver_->x(idxMap.local(cell, 0), 0);
+            field_(cell).y = solver_->x(idxMap.local(cell, 0), 1);
+        }
+    }
+    else
+    {
+        if (solver_->supportsMultipleRhs())
+            solver_->setNumVectors(1);
+
+        solver_->setRank(getRank());
+        solver_->set(rowPtr_, colInd_, vals_);
+        solver_->setRhs(-rhs_);
+
+        if (solver_->type() == SparseMatrixSolver::TRILINOS_MUELU)
+            std::static_pointer_cast<TrilinosMueluSparseMatrixSolver>(solver_)->setCoordinates(
+                        field_.grid()->localCells().coordinates());
+
+        solver_->solve();
+
+        mapFromSparseSolver();
+    }
+
+    solver_->printStatus("FiniteVolumeEquation " + name + ":");
+
+    return solver_->error();
+}
+
 //- Functions
 template<>
 FiniteVolumeEquation<Vector2D> operator * (const ScalarFiniteVolumeField &lhs, FiniteVolumeEquation<Vector2D> rhs)
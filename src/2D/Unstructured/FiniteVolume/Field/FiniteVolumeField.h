@@ -195,10 +195,24 @@ public:
     const FiniteVolumeField &prevIteration() const
     { return *previousIteration_; }
 
+    //- Checkpoints, with the raw cell, face and node values followed by the history levels
+    void writeCheckpoint(std::ostream &os) const;
+
+    void readCheckpoint(std::istream &is);
+
     //- Parallel
 
     void sendMessages();
 
+    //- Non-blocking halo exchange, cell values must not be modified in between. interpolateFaces ends a pending
+    //- exchange once the faces between local cells are done.
+    void beginExchange();
+
+    void endExchange();
+
+    bool exchangePending() const
+    { return exchangePending_; }
+
     //- Operators
 
     FiniteVolumeField &operator+=(const FiniteVolumeField &rhs);
@@ -225,13 +239,14 @@ protected:
 
     typedef std::pair<Scalar, FiniteVolumeField<T>> PreviousField;
 
-    //- Parallel
-    static std::vector<std::vector<T>> sendBuffers_, recvBuffers_;
-
     void setBoundaryTypes(const Input &input);
 
     void setBoundaryRefValues(const Input &input);
 
+    //- Copies cell and face values into a history level, which is only (re)allocated when missing, shared with
+    //- another field or sized for a different grid
+    void saveValues(std::shared_ptr<FiniteVolumeField<T>> &level) const;
+
     //- Data members
     std::unordered_map<std::string, std::pair<BoundaryType, T> > patchBoundaries_;
 
@@ -244,13 +259,15 @@ protected:
     //- Misc data
     std::vector<T> faces_, nodes_;
 
-    //- Field history
-    std::deque<std::pair<Scalar, std::shared_ptr<FiniteVolumeField<T>>>> previousTimeSteps_;
+    //- Field history, a fixed ring of time levels that rotates on each save
+    std::vector<std::pair<Scalar, std::shared_ptr<FiniteVolumeField<T>>>> previousTimeSteps_;
 
     std::shared_ptr<FiniteVolumeField<T>> previousIteration_;
 
     //- Index map
     std::shared_ptr<IndexMap> indexMap_;
+
+    bool exchangePending_ = false;
 };
 
 #include "FiniteVolumeField.tpp"
@@ -3,18 +3,10 @@
 #include <boost/algorithm/string.hpp>
 
 #include "System/Exception.h"
+#include "System/BinaryStream.h"
 
 #include "FiniteVolume/Field/FiniteVolumeField.h"
 
-//- Static
-
-//- Parallel
-template<class T>
-std::vector<std::vector<T>> FiniteVolumeField<T>::sendBuffers_;
-
-template<class T>
-std::vector<std::vector<T>> FiniteVolumeField<T>::recvBuffers_;
-
 //- Constructors
 
 template<class T>
@@ -132,7 +124,16 @@ void FiniteVolumeField<T>::interpolateFaces(const TFunc &alpha)
 {
     auto &self = *this;
 
-    for (const Face &face: grid_->interiorFaces())
+    for (const Face &face: grid_->innerFaces())
+    {
+        Scalar g = alpha(face);
+        self(face) = g * self(face.lCell()) + (1. - g) * self(face.rCell());
+    }
+
+    if (exchangePending_)
+        endExchange();
+
+    for (const Face &face: grid_->nearHaloFaces())
     {
         Scalar g = alpha(face);
         self(face) = g * self(face.lCell()) + (1. - g) * self(face.rCell());
@@ -208,20 +209,20 @@ void FiniteVolumeField<T>::interpolateNodes()
 template<class T>
 FiniteVolumeField<T> &FiniteVolumeField<T>::savePreviousTimeStep(Scalar timeStep, int nPreviousFields)
 {
-    std::shared_ptr<FiniteVolumeField<T>> tmp;
+    //- Levels that have never been saved are padded with the oldest saved level
+    int nSaved = std::min((int) previousTimeSteps_.size(), nPreviousFields);
 
-    if(previousTimeSteps_.size() >= nPreviousFields)
-    {
-        tmp = previousTimeSteps_.back().second;
-        *tmp = *this;
-    }
-    else
-        tmp = std::make_shared<FiniteVolumeField<T>>(*this);
+    previousTimeSteps_.resize(nPreviousFields);
+    std::rotate(previousTimeSteps_.begin(), previousTimeSteps_.end() - 1, previousTimeSteps_.end());
 
-    tmp->clearHistory();
+    previousTimeSteps_[0].first = timeStep;
+    saveValues(previousTimeSteps_[0].second);
 
-    previousTimeSteps_.emplace_front(timeStep, tmp);
-    previousTimeSteps_.resize(nPreviousFields, previousTimeSteps_.back());
+    for (int i = nSaved + 1; i < nPreviousFields; ++i)
+    {
+        previousTimeSteps_[i].first = previousTimeSteps_[nSaved].first;
+        previousTimeSteps_[nSaved].second->saveValues(previousTimeSteps_[i].second);
+    }
 
     return *previousTimeSteps_.front().second;
 }
@@ -229,12 +230,7 @@ FiniteVolumeField<T> &FiniteVolumeField<T>::savePreviousTimeStep(Scalar timeStep
 template<class T>
 FiniteVolumeField<T> &FiniteVolumeField<T>::savePreviousIteration()
 {
-    if(previousIteration_)
-        *previousIteration_ = *this;
-    else
-        previousIteration_ = std::make_shared<FiniteVolumeField<T>>(*this);
-
-    previousIteration_->clearHistory();
+    saveValues(previousIteration_);
     return *previousIteration_;
 }
 
@@ -245,54 +241,64 @@ void FiniteVolumeField<T>::clearHistory()
     previousTimeSteps_.clear();
 }
 
-//- Parallel
+//- Checkpoints
 
 template<class T>
-void FiniteVolumeField<T>::sendMessages()
+void FiniteVolumeField<T>::writeCheckpoint(std::ostream &os) const
 {
-    sendBuffers_.resize(grid_->comm().nProcs());
-    recvBuffers_.resize(grid_->comm().nProcs());
+    binary::write(os, static_cast<const std::vector<T>&>(*this));
+    binary::write(os, faces_);
+    binary::write(os, nodes_);
+    binary::write(os, (unsigned long) previousTimeSteps_.size());
 
-    //- Post recvs
-    for(int proc = 0; proc < grid_->comm().nProcs(); ++proc)
+    for (const auto &level: previousTimeSteps_)
     {
-        if(proc == grid_->comm().rank())
-            continue;
-
-        recvBuffers_[proc].resize(grid_->bufferGroups()[proc].size());
-        grid_->comm().irecv(proc, recvBuffers_[proc], proc);
+        binary::write(os, level.first);
+        binary::write(os, static_cast<const std::vector<T>&>(*level.second));
+        binary::write(os, level.second->faces_);
     }
+}
 
-    //- Post sends
-    for(int proc = 0; proc < grid_->comm().nProcs(); ++proc)
-    {
-        if(proc == grid_->comm().rank())
-            continue;
-
-        const CellSet &sendCells = grid_->sendGroups()[proc];
+template<class T>
+void FiniteVolumeField<T>::readCheckpoint(std::istream &is)
+{
+    binary::read(is, static_cast<std::vector<T>&>(*this));
+    binary::read(is, faces_);
+    binary::read(is, nodes_);
 
-        sendBuffers_[proc].resize(sendCells.size());
-        std::transform(sendCells.begin(), sendCells.end(), sendBuffers_[proc].begin(),
-                       [this](const Cell &c) { return (*this)(c); });
+    unsigned long nLevels;
+    binary::read(is, nLevels);
+    previousTimeSteps_.resize(nLevels);
 
-        grid_->comm().isend(proc, sendBuffers_[proc], grid_->comm().rank());
+    for (auto &level: previousTimeSteps_)
+    {
+        binary::read(is, level.first);
+        saveValues(level.second);
+        binary::read(is, static_cast<std::vector<T>&>(*level.second));
+        binary::read(is, level.second->faces_);
     }
+}
 
-    //- Sync
-    grid_->comm().waitAll();
+//- Parallel
 
-    //- Unload recv buffers
-    for(int proc = 0; proc < grid_->comm().nProcs(); ++proc)
-    {
-        if(proc == grid_->comm().rank())
-            continue;
+template<class T>
+void FiniteVolumeField<T>::sendMessages()
+{
+    grid_->sendMessages(*this);
+}
 
-        const std::vector<T> &buff = recvBuffers_[proc];
+template<class T>
+void FiniteVolumeField<T>::beginExchange()
+{
+    grid_->beginSendMessages(*this);
+    exchangePending_ = true;
+}
 
-        int i = 0;
-        for(const Cell &c: grid_->bufferGroups()[proc])
-            (*this)(c) = buff[i++];
-    }
+template<class T>
+void FiniteVolumeField<T>::endExchange()
+{
+    grid_->endSendMessages(*this);
+    exchangePending_ = false;
 }
 
 //- Operators
@@ -422,6 +428,20 @@ void FiniteVolumeField<T>::writeToFile(const std::string &filename) const
 
 //- Protected methods
 
+template<class T>
+void FiniteVolumeField<T>::saveValues(std::shared_ptr<FiniteVolumeField<T>> &level) const
+{
+    if (!level || level.use_count() > 1 || level->grid_ != grid_ || level->faces_.size() != faces_.size())
+    {
+        level = std::make_shared<FiniteVolumeField<T>>(grid_, this->name(), T(), hasFaces(), false);
+        level->patchBoundaries_ = patchBoundaries_;
+    }
+
+    level->cellGroup_ = cellGroup_;
+    std::copy(this->begin(), this->end(), level->begin());
+    std::copy(faces_.begin(), faces_.end(), level->faces_.begin());
+}
+
 template<class T>
 void FiniteVolumeField<T>::setBoundaryTypes(const Input &input)
 {
@@ -44,10 +44,15 @@ void ScalarGradient::computeFaces()
 {
     VectorFiniteVolumeField &gradPhi = *this;
 
+    const std::vector<Point2D> &centroids = grid_->cellCentroids();
+    const std::vector<Index> &owners = grid_->faceOwners();
+    const std::vector<Index> &neighbours = grid_->faceNeighbours();
+
     for (const Face &face: grid_->interiorFaces())
     {
-        Vector2D rc = face.rCell().centroid() - face.lCell().centroid();
-        gradPhi(face) = (phi_(face.rCell()) - phi_(face.lCell())) * rc / rc.magSqr();
+        Index l = owners[face.id()], r = neighbours[face.id()];
+        Vector2D rc = centroids[r] - centroids[l];
+        gradPhi(face) = (phi_(r) - phi_(l)) * rc / rc.magSqr();
     }
 
     for (const Face &face: grid_->boundaryFaces())
@@ -60,98 +65,124 @@ void ScalarGradient::computeFaces()
 void ScalarGradient::compute(const CellGroup &group, Method method)
 {
     computeFaces();
+
+    for (const Cell &cell: group)
+        computeCell(cell, method);
+}
+
+void ScalarGradient::computeAndExchange(const CellGroup &group, Method method)
+{
+    computeFaces();
+
+    //- Cells needed by other procs are computed first, the rest are computed while the exchange is in flight
+    for (const Cell &cell: group)
+        if (grid_->isNearHalo(cell))
+            computeCell(cell, method);
+
+    beginExchange();
+
+    for (const Cell &cell: group)
+        if (!grid_->isNearHalo(cell))
+            computeCell(cell, method);
+
+    endExchange();
+}
+
+void ScalarGradient::compute(Method method)
+{
+    compute(*cellGroup_, method);
+}
+
+void ScalarGradient::computeCell(const Cell &cell, Method method)
+{
     VectorFiniteVolumeField &gradPhi = *this;
 
-    //std::fill(gradPhi.begin(), gradPhi.end(), Vector2D(0., 0.));
+    const std::vector<Label> &linkPtr = grid_->cellLinkPtr();
+    const std::vector<Label> &linkCells = grid_->linkCells();
+    const std::vector<Label> &linkFaces = grid_->linkFaces();
+    const std::vector<Vector2D> &linkNorms = grid_->linkNorms();
+    const std::vector<Scalar> &linkWeights = grid_->linkWeights();
 
     switch (method)
     {
     case FACE_TO_CELL:
-        for (const Cell &cell: group)
+    {
+        Vector2D sum(0., 0.), tmp(0., 0.);
+
+        for (Label j = linkPtr[cell.id()]; j < linkPtr[cell.id() + 1]; ++j)
         {
-            Vector2D sum(0., 0.), tmp(0., 0.);
-
-            for (const InteriorLink &nb: cell.neighbours())
-            {
-                Vector2D sf = nb.outwardNorm().abs();
-                tmp += pointwise(gradPhi(nb.face()), sf);
-                sum += sf;
-            }
-
-            for (const BoundaryLink &bd: cell.boundaries())
-            {
-                Vector2D sf = bd.outwardNorm().abs();
-                tmp += pointwise(gradPhi(bd.face()), sf);
-                sum += sf;
-            }
-
-            gradPhi(cell) = Vector2D(tmp.x / sum.x, tmp.y / sum.y);
+            Vector2D sf = linkNorms[j].abs();
+            tmp += pointwise(gradPhi.faces()[linkFaces[j]], sf);
+            sum += sf;
         }
+
+        for (const BoundaryLink &bd: cell.boundaries())
+        {
+            Vector2D sf = bd.outwardNorm().abs();
+            tmp += pointwise(gradPhi(bd.face()), sf);
+            sum += sf;
+        }
+
+        gradPhi(cell) = Vector2D(tmp.x / sum.x, tmp.y / sum.y);
+    }
         break;
     case GREEN_GAUSS_CELL:
-        for (const Cell &cell: group)
+    {
+        for (Label j = linkPtr[cell.id()]; j < linkPtr[cell.id() + 1]; ++j)
         {
-            for (const InteriorLink &nb: cell.neighbours())
-            {
-                Scalar g = nb.distanceWeight();
-                Scalar phiF = g * phi_(cell) + (1. - g) * phi_(nb.cell());
-                gradPhi(cell) += phiF * nb.outwardNorm();
-            }
+            Scalar g = linkWeights[j];
+            Scalar phiF = g * phi_(cell) + (1. - g) * phi_(linkCells[j]);
+            gradPhi(cell) += phiF * linkNorms[j];
+        }
 
-            for (const BoundaryLink &bd: cell.boundaries())
-                gradPhi(cell) += phi_(bd.face()) * bd.outwardNorm();
+        for (const BoundaryLink &bd: cell.boundaries())
+            gradPhi(cell) += phi_(bd.face()) * bd.outwardNorm();
 
-            gradPhi(cell) /= cell.volume();
-        }
+        gradPhi(cell) /= cell.volume();
+    }
         break;
     case GREEN_GAUSS_NODE:
-        for (const Cell &cell: group)
+    {
+        for (const InteriorLink &nb: cell.neighbours())
+        {
+            auto lNodeWeights = nb.face().lNode().distanceWeights();
+            auto rNodeWeights = nb.face().rNode().distanceWeights();
+            Scalar phiLN = 0, phiRN = 0;
+            int i = 0;
+            for (const Cell &cell: nb.face().lNode().cells())
+                phiLN += lNodeWeights[i++] * phi_(cell);
+
+            i = 0;
+            for (const Cell &cell: nb.face().rNode().cells())
+                phiRN += rNodeWeights[i++] * phi_(cell);
+
+            Scalar phiF = (phiLN + phiRN) / 2.;
+            gradPhi(cell) += phiF * nb.outwardNorm();
+        }
+
+        for (const BoundaryLink &bd: cell.boundaries())
         {
-            for (const InteriorLink &nb: cell.neighbours())
-            {
-                auto lNodeWeights = nb.face().lNode().distanceWeights();
-                auto rNodeWeights = nb.face().rNode().distanceWeights();
-                Scalar phiLN = 0, phiRN = 0;
-                int i = 0;
-                for (const Cell &cell: nb.face().lNode().cells())
-                    phiLN += lNodeWeights[i++] * phi_(cell);
-
-                i = 0;
-                for (const Cell &cell: nb.face().rNode().cells())
-                    phiRN += rNodeWeights[i++] * phi_(cell);
-
-                Scalar phiF = (phiLN + phiRN) / 2.;
-                gradPhi(cell) += phiF * nb.outwardNorm();
-            }
-
-            for (const BoundaryLink &bd: cell.boundaries())
-            {
-                auto lNodeWeights = bd.face().lNode().distanceWeights();
-                auto rNodeWeights = bd.face().rNode().distanceWeights();
-                Scalar phiLN = 0, phiRN = 0;
-                int i = 0;
-                for (const Cell &cell: bd.face().lNode().cells())
-                    phiLN += lNodeWeights[i++] * phi_(cell);
-
-                i = 0;
-                for (const Cell &cell: bd.face().rNode().cells())
-                    phiRN += rNodeWeights[i++] * phi_(cell);
-
-                Scalar phiF = (phiLN + phiRN) / 2.;
-                gradPhi(cell) += phiF * bd.outwardNorm();
-            }
-
-            gradPhi(cell) /= cell.volume();
+            auto lNodeWeights = bd.face().lNode().distanceWeights();
+            auto rNodeWeights = bd.face().rNode().distanceWeights();
+            Scalar phiLN = 0, phiRN = 0;
+            int i = 0;
+            for (const Cell &cell: bd.face().lNode().cells())
+                phiLN += lNodeWeights[i++] * phi_(cell);
+
+            i = 0;
+            for (const Cell &cell: bd.face().rNode().cells())
+                phiRN += rNodeWeights[i++] * phi_(cell);
+
+            Scalar phiF = (phiLN + phiRN) / 2.;
+            gradPhi(cell) += phiF * bd.outwardNorm();
         }
+
+        gradPhi(cell) /= cell.volume();
+    }
         break;
     }
 }
 
-void ScalarGradient::compute(Method method)
-{
-    compute(*cellGroup_, method);
-}
-
 void ScalarGradient::computeAxisymmetric(const CellGroup &cells)
 {
     computeFaces();
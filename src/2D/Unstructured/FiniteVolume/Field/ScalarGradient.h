@@ -22,12 +22,17 @@ public:
 
     void compute(Method method = FACE_TO_CELL);
 
+    //- Computes the gradient and updates the halo, overlapping the exchange with the interior cells
+    void computeAndExchange(const CellGroup &cells, Method method = FACE_TO_CELL);
+
     void computeAxisymmetric(const CellGroup &cells);
 
     void computeAxisymmetric(const ScalarFiniteVolumeField &cw, const ScalarFiniteVolumeField &fw, const CellGroup &cells);
 
 private:
 
+    void computeCell(const Cell &cell, Method method);
+
     const ScalarFiniteVolumeField &phi_;
 
 };
@@ -13,6 +13,10 @@ public:
 
     virtual Vector2D force(const ImmersedBoundaryObject& ibObj, const FiniteVolumeGrid2D& grid) const;
 
+    //- Distance beyond contact at which the collision force becomes active, used for the broad phase
+    Scalar range() const
+    { return range_; }
+
 private:
 
     Scalar eps_, range_;
@@ -1,4 +1,10 @@
+#include <unordered_set>
+#include <exception>
+
+#include <boost/geometry/algorithms/expand.hpp>
+
 #include "Math/TrilinosAmesosSparseMatrixSolver.h"
+#include "Geometry/Box.h"
 
 #include "DirectForcingImmersedBoundary.h"
 #include "DirectForcingImmersedBoundaryLeastSquaresQuadraticStencil.h"
@@ -14,6 +20,49 @@ DirectForcingImmersedBoundary::DirectForcingImmersedBoundary(const Input &input,
 
 void DirectForcingImmersedBoundary::updateCells()
 {
+    std::vector<Label> movedIbObjs;
+
+    for(Label id = 0; id < ibObjs_.size(); ++id)
+    {
+        const auto &ibObj = ibObjs_[id];
+
+        if(id == ibObjStates_.size())
+        {
+            ibObjStates_.push_back(IbObjState{ibObj->position(), ibObj->theta(), ibObj->shape().boundingBox()});
+
+            //- An object added after the cells were classified is reclassified like a moved one, over its own box
+            if(classifiedDomainCells_)
+                movedIbObjs.push_back(id);
+        }
+        else if(!(ibObjStates_[id].position == ibObj->position()) || ibObjStates_[id].theta != ibObj->theta())
+            movedIbObjs.push_back(id);
+    }
+
+    if(classifiedDomainCells_ != domainCells_.get())
+    {
+        classifyAllCells();
+        classifiedDomainCells_ = domainCells_.get();
+    }
+    else if(movedIbObjs.empty())
+        changedCells_.clear(); //- The ib objects are the same on every proc, so no proc has anything to exchange
+    else
+        reclassifyCells(movedIbObjs);
+
+    updateStencils(movedIbObjs);
+
+    for(Label id: movedIbObjs)
+        ibObjStates_[id] = IbObjState{ibObjs_[id]->position(), ibObjs_[id]->theta(), ibObjs_[id]->shape().boundingBox()};
+}
+
+const DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil &DirectForcingImmersedBoundary::stencil(const Cell &cell) const
+{
+    return *stencils_[cell.id()];
+}
+
+void DirectForcingImmersedBoundary::classifyAllCells()
+{
+    std::vector<int> oldCellStatus = *cellStatus_;
+
     localIbCells_.clear();
     localSolidCells_.clear();
 
@@ -53,6 +102,170 @@ void DirectForcingImmersedBoundary::updateCells()
     }
 
     cellStatus_->sendMessages();
+
+    changedCells_.clear();
+
+    for(const Cell &cell: grid_->cells())
+        if(oldCellStatus[cell.id()] != (*cellStatus_)(cell))
+            changedCells_.push_back(cell.id());
+}
+
+void DirectForcingImmersedBoundary::reclassifyCells(const std::vector<Label> &movedIbObjs)
+{
+    //- Solid cells can only change within the swept boxes, ib cells also one neighbour beyond. Buffer cells are
+    //- included so that local cells next to them are also reclassified
+    CellSet region, affected;
+
+    for(Label id: movedIbObjs)
+    {
+        auto box = ibObjStates_[id].box;
+        boost::geometry::expand(box, ibObjs_[id]->shape().boundingBox());
+
+        auto cells = grid_->globalCells().itemsWithin(Box(box.min_corner(), box.max_corner()));
+        region.add(cells.begin(), cells.end());
+    }
+
+    affected.add(region);
+
+    for(const Cell &cell: region)
+        for(const CellLink &nb: cell.neighbours())
+            affected.add(nb.cell());
+
+    std::vector<std::pair<Label, int>> oldCellStatus;
+    oldCellStatus.reserve(affected.size());
+
+    CellSet resetCells;
+
+    for(const Cell &cell: affected)
+    {
+        int status = (*cellStatus_)(cell);
+        oldCellStatus.push_back(std::make_pair(cell.id(), status));
+
+        if(status == IB_CELLS || (status == SOLID_CELLS && region.isInSet(cell)))
+        {
+            resetCells.add(cell);
+            (*cellStatus_)(cell) = FLUID_CELLS;
+        }
+    }
+
+    localIbCells_.remove(resetCells);
+    localSolidCells_.remove(resetCells);
+
+    for(auto &ibObj: ibObjs_)
+        ibObj->removeCells(resetCells);
+
+    //- The first ib object containing a cell owns it, as in classifyAllCells
+    for(const Cell &c: region)
+    {
+        if(!domainCells_->isInSet(c))
+            continue;
+
+        auto ibObjP = ibObj(c.centroid());
+
+        if(ibObjP && localSolidCells_.add(c))
+        {
+            ibObjP->addSolidCell(c);
+            (*cellStatus_)(c) = SOLID_CELLS;
+        }
+    }
+
+    cellStatus_->sendMessages();
+
+    for(const Cell &c: affected)
+    {
+        if(!domainCells_->isInSet(c) || (*cellStatus_)(c) == SOLID_CELLS)
+            continue;
+
+        for(const CellLink &nb: c.neighbours())
+        {
+            if((*cellStatus_)(nb.cell()) == SOLID_CELLS)
+            {
+                if(localIbCells_.add(c))
+                {
+                    ibObj(nb.cell())->addIbCell(c);
+                    (*cellStatus_)(c) = IB_CELLS;
+                }
+                break;
+            }
+        }
+    }
+
+    cellStatus_->sendMessages();
+
+    changedCells_.clear();
+
+    for(const auto &entry: oldCellStatus)
+        if((*cellStatus_)(grid_->cells()[entry.first]) != entry.second)
+            changedCells_.push_back(entry.first);
+}
+
+void DirectForcingImmersedBoundary::updateStencils(const std::vector<Label> &movedIbObjs)
+{
+    //- A stencil reaches the neighbours and diagonals of its cell and the neighbours of those, so a change in status
+    //- invalidates every stencil within that reach
+    std::unordered_set<Label> invalid;
+
+    for(Label id: changedCells_)
+    {
+        const Cell &cell = grid_->cells()[id];
+
+        invalid.insert(cell.id());
+
+        for(const CellLink &nb: cell.neighbours())
+        {
+            invalid.insert(nb.cell().id());
+
+            for(const CellLink &nb2: nb.cell().neighbours())
+            {
+                invalid.insert(nb2.cell().id());
+
+                for(const CellLink &dg: nb2.cell().diagonals())
+                    invalid.insert(dg.cell().id());
+            }
+        }
+
+        for(const CellLink &dg: cell.diagonals())
+            invalid.insert(dg.cell().id());
+    }
+
+    stencils_.resize(grid_->cells().size());
+
+    for(Label id: changedCells_)
+        if(!localIbCells_.isInSet(grid_->cells()[id]))
+            stencils_[id] = nullptr;
+
+    //- Stencils are independent of one another, so they are rebuilt concurrently. Exceptions cannot leave the parallel
+    //- region, so the first failure is kept and rethrown after it
+    std::exception_ptr error;
+
+#pragma omp parallel for
+    for(Label i = 0; i < localIbCells_.size(); ++i)
+    {
+        const Cell &cell = localIbCells_[i];
+        auto &st = stencils_[cell.id()];
+
+        bool rebuild = !st || invalid.find(cell.id()) != invalid.end();
+
+        for(auto id = movedIbObjs.begin(); !rebuild && id != movedIbObjs.end(); ++id)
+            rebuild = std::find(st->ibObjs().begin(), st->ibObjs().end(), ibObjs_[*id].get()) != st->ibObjs().end();
+
+        if(rebuild)
+        {
+            try
+            {
+                st = std::make_shared<const LeastSquaresQuadraticStencil>(cell, *this);
+            }
+            catch(...)
+            {
+#pragma omp critical
+                if(!error)
+                    error = std::current_exception();
+            }
+        }
+    }
+
+    if(error)
+        std::rethrow_exception(error);
 }
 
 FiniteVolumeEquation<Vector2D> DirectForcingImmersedBoundary::computeForcingTerm(const VectorFiniteVolumeField &u,
@@ -64,7 +277,7 @@ FiniteVolumeEquation<Vector2D> DirectForcingImmersedBoundary::computeForcingTerm
     {
         if(localIbCells_.isInSet(cell))
         {
-            auto st = DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil(cell, *this);
+            const auto &st = stencil(cell);
 
             auto beta = st.interpolationCoeffs(cell.centroid());
 
@@ -125,7 +338,7 @@ FiniteVolumeEquation<Vector2D> DirectForcingImmersedBoundary::velocityBcs(Vector
     {
         if(localIbCells_.isInSet(cell))
         {
-            auto st = DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil(cell, *this);
+            const auto &st = stencil(cell);
             auto beta = st.interpolationCoeffs(cell.centroid());
 
             int i = 0;
@@ -173,7 +386,7 @@ FiniteVolumeEquation<Vector2D> DirectForcingImmersedBoundary::continuityVelocity
     {
         if(localIbCells_.isInSet(cell))
         {
-            auto st = DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil(cell, *this);
+            const auto &st = stencil(cell);
             auto beta = st.continuityConstrainedInterpolationCoeffs(cell.centroid());
 
             //std::cout << beta.m() << " " << beta.n() << std::endl;
@@ -237,7 +450,7 @@ FiniteVolumeEquation<Vector2D> DirectForcingImmersedBoundary::polarVelocityBcs(V
     {
         if(localIbCells_.isInSet(cell))
         {
-            auto st = DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil(cell, *this);
+            const auto &st = stencil(cell);
             auto beta = st.interpolationCoeffs(cell.centroid());
             Scalar vol = cell.polarVolume();
             int i = 0;
@@ -285,7 +498,7 @@ FiniteVolumeEquation<Vector2D> DirectForcingImmersedBoundary::continuityPolarVel
     {
         if(localIbCells_.isInSet(cell))
         {
-            auto st = DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil(cell, *this);
+            const auto &st = stencil(cell);
             auto beta = st.polarQuadraticContinuityConstrainedInterpolationCoeffs(cell.centroid());
 
             int i = 0;
@@ -377,7 +590,7 @@ void DirectForcingImmersedBoundary::applyHydrodynamicForce(Scalar rho,
         Index row = 0;
         for(const Cell &cell: ibObj->ibCells())
         {
-            auto st = DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil(cell, *this);
+            const auto &st = stencil(cell);
 
             //- Compute the stress tensor
             Matrix A(st.nReconstructionPoints(), 6), rhs(st.nReconstructionPoints(), 2);
@@ -576,7 +789,7 @@ void DirectForcingImmersedBoundary::applyHydrodynamicForce(const ScalarFiniteVol
         Index row = 0;
         for(const Cell &cell: ibObj->ibCells())
         {
-            auto st = DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil(cell, *this);
+            const auto &st = stencil(cell);
 
             //- Compute the stress tensor
             Matrix A(st.nReconstructionPoints(), 6), rhs(st.nReconstructionPoints(), 2);
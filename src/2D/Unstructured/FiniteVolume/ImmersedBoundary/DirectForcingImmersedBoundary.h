@@ -18,8 +18,16 @@ public:
                                   const std::shared_ptr<const FiniteVolumeGrid2D> &grid,
                                   const std::shared_ptr<CellGroup> &domainCells);
 
+    //- Only cells near ib objects that moved since the last call are reclassified
     void updateCells() override;
 
+    //- Local and buffer cells whose status changed in the last call to updateCells
+    const std::vector<Label> &changedCells() const
+    { return changedCells_; }
+
+    //- Cached stencil of a local ib cell, valid until the next call to updateCells
+    const LeastSquaresQuadraticStencil &stencil(const Cell &cell) const;
+
     FiniteVolumeEquation<Vector2D> computeForcingTerm(const VectorFiniteVolumeField &u,
                                                       Scalar timeStep,
                                                       VectorFiniteVolumeField &fib) const;
@@ -70,8 +78,36 @@ public:
 
 private:
 
+    //- Classifies every domain cell, used the first time and whenever the domain cells are replaced
+    void classifyAllCells();
+
+    //- Reclassifies the cells within the old and new bounding boxes of the given ib objects and their neighbours
+    void reclassifyCells(const std::vector<Label> &movedIbObjs);
+
+    //- Rebuilds the stencils of ib cells that are new, near a change in cell status or near an ib object that moved
+    void updateStencils(const std::vector<Label> &movedIbObjs);
+
     CellGroup localIbCells_, localSolidCells_;
 
+    std::vector<Label> changedCells_;
+
+    std::vector<std::shared_ptr<const LeastSquaresQuadraticStencil>> stencils_;
+
+    //- Position, orientation and bounding box of each ib object when the cells were last classified
+    struct IbObjState
+    {
+        Point2D position;
+
+        Scalar theta;
+
+        boost::geometry::model::box<Point2D> box;
+    };
+
+    std::vector<IbObjState> ibObjStates_;
+
+    //- Domain cells the current classification was computed for
+    const CellGroup *classifiedDomainCells_ = nullptr;
+
     CellGroup globalIbCells_, globalSolidCells_;
 };
 
@@ -1,23 +1,80 @@
 #include "DirectForcingImmersedBoundaryLeastSquaresQuadraticStencil.h"
 
-std::vector<std::vector<const ImmersedBoundaryObject*>> DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::_ibObjSets(2);
+namespace
+{
+    typedef DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil Stencil;
+
+    //- At most two rows per reconstruction point plus a constraint row, and up to twelve polynomial coefficients
+    typedef StaticMatrix<2 * Stencil::MAX_POINTS + 1, 12> System;
+
+    //- Sets the leading entries of row i, unlike StaticMatrix::setRow the list may be shorter than the row
+    template<int M, int N>
+    void setRow(StaticMatrix<M, N> &A, int i, const std::initializer_list<Scalar> &vals)
+    {
+        std::copy(vals.begin(), vals.end(), &A(i, 0));
+    }
+
+    //- Returns b * pinv(A) for the leading m x n block of A, using the shared Householder QR kernel on stack storage.
+    //- Underdetermined or rank deficient blocks fall back to LAPACK, as in pseudoInverse
+    Stencil::Coeffs pinvCoeffs(const System &A, int m, int n, const StaticMatrix<2, 12> &b, int k)
+    {
+        const int maxRows = 2 * Stencil::MAX_POINTS + 1;
+        Scalar block[maxRows * 12], P[12 * maxRows];
+
+        auto copyBlock = [&]()
+        {
+            for (int i = 0; i < m; ++i)
+                std::copy(A.data() + i * 12, A.data() + i * 12 + n, block + i * n);
+        };
+
+        copyBlock();
+        bool factored = false;
+
+        if (m >= n)
+        {
+            Scalar work[maxRows * maxRows];
+            factored = dense::qrPseudoInverse(m, n, block, P, work);
+        }
+
+        if (!factored)
+        {
+            //- The solution occupies the leading n rows of the right-hand side
+            Scalar I[maxRows * maxRows];
+            std::fill(I, I + std::max(m, n) * m, 0.);
+
+            for (int i = 0; i < m; ++i)
+                I[i * m + i] = 1.;
 
-Matrix DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::_A;
+            copyBlock();
+            LAPACKE_dgels(LAPACK_ROW_MAJOR, 'N', m, n, m, block, n, I, m);
+            std::copy(I, I + n * m, P);
+        }
+
+        Stencil::Coeffs coeffs;
 
-Matrix DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::_b;
+        for (int r = 0; r < k; ++r)
+            for (int l = 0; l < n; ++l)
+                for (int i = 0; i < m; ++i)
+                    coeffs(r, i) += b(r, l) * P[l * m + i];
+
+        return coeffs;
+    }
+}
 
 DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::LeastSquaresQuadraticStencil(const Cell &cell,
                                                                                           const DirectForcingImmersedBoundary &ib)
 {
-    _ibObjSets[0].clear();
+    StaticVector<const ImmersedBoundaryObject*, 8> ibObjSet;
+
     for(const CellLink &nb: cell.neighbours())
     {
         auto ibObj = ib.ibObj(nb.cell());
+        addIbObj(ibObj.get());
 
-        if(ibObj && std::find(_ibObjSets[0].begin(), _ibObjSets[0].end(), ibObj.get()) == _ibObjSets[0].end())
+        if(ibObj && std::find(ibObjSet.begin(), ibObjSet.end(), ibObj.get()) == ibObjSet.end())
         {
             _compatPts.push_back(CompatPoint(cell, *ibObj));
-            _ibObjSets[0].emplace_back(ibObj.get());
+            ibObjSet.push_back(ibObj.get());
         }
         else
             _cells.push_back(&nb.cell());
@@ -26,6 +83,7 @@ DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::LeastSquaresQuadrat
     for(const CellLink &nb: cell.diagonals())
     {
         auto ibObj = ib.ibObj(nb.cell());
+        addIbObj(ibObj.get());
 
         if(!ibObj)
             _cells.push_back(&nb.cell());
@@ -34,29 +92,34 @@ DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::LeastSquaresQuadrat
     for(const BoundaryLink &bd: cell.boundaries())
     {
         auto ibObj = ib.ibObj(bd.face().centroid());
+        addIbObj(ibObj.get());
+
         if(!ibObj)
             _faces.push_back(&bd.face());
     }
 
     for(const Cell *stCell: _cells)
     {
-        _ibObjSets[1].clear();
+        StaticVector<const ImmersedBoundaryObject*, 8> stIbObjSet;
 
         for(const CellLink &nb: stCell->neighbours())
         {
             auto ibObj = ib.ibObj(nb.cell());
+            addIbObj(ibObj.get());
 
-            if(ibObj && std::find(_ibObjSets[0].begin(), _ibObjSets[0].end(), ibObj.get()) != _ibObjSets[0].end()
-                    && std::find(_ibObjSets[1].begin(), _ibObjSets[1].end(), ibObj.get()) == _ibObjSets[1].end())
+            if(ibObj && std::find(ibObjSet.begin(), ibObjSet.end(), ibObj.get()) != ibObjSet.end()
+                    && std::find(stIbObjSet.begin(), stIbObjSet.end(), ibObj.get()) == stIbObjSet.end())
             {
                 _compatPts.push_back(CompatPoint(*stCell, *ibObj));
-                _ibObjSets[1].emplace_back(ibObj.get());
+                stIbObjSet.push_back(ibObj.get());
             }
         }
 
         for(const BoundaryLink &bd: stCell->boundaries())
         {
             auto ibObj = ib.ibObj(bd.face().centroid());
+            addIbObj(ibObj.get());
+
             if(!ibObj)
                 _faces.push_back(&bd.face());
         }
@@ -71,7 +134,8 @@ DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::LeastSquaresQuadrat
                         + ", Num compat pts = " + std::to_string(_compatPts.size()) + ".");
 }
 
-Matrix DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::interpolationCoeffs(const Point2D &x) const
+DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::Coeffs
+DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::interpolationCoeffs(const Point2D &x) const
 {
     if(nReconstructionPoints() >= 6)
         return quadraticInterpolationCoeffs(x);
@@ -79,74 +143,94 @@ Matrix DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::interpolatio
         return linearInterpolationCoeffs(x);
     else if(_compatPts.size()  == 2)
         return subgridInterpolationCoeffs(x);
+
+    throw Exception("DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil",
+                    "interpolationCoeffs",
+                    "no interpolation is possible with the available reconstruction points.");
 }
 
-Matrix DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::continuityConstrainedInterpolationCoeffs(const Point2D &pt) const
+DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::Coeffs
+DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::continuityConstrainedInterpolationCoeffs(const Point2D &pt) const
 {
     return quadraticContinuityConstrainedInterpolationCoeffs(pt);
 }
 
-Matrix DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::linearInterpolationCoeffs(const Point2D &x) const
+void DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::addIbObj(const ImmersedBoundaryObject *ibObj)
+{
+    if(!ibObj || std::find(_ibObjs.begin(), _ibObjs.end(), ibObj) != _ibObjs.end())
+        return;
+
+    if(_ibObjs.size() == _ibObjs.capacity())
+        throw Exception("DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil",
+                        "addIbObj",
+                        "stencil is influenced by more than " + std::to_string(_ibObjs.capacity())
+                        + " ib objects.");
+
+    _ibObjs.push_back(ibObj);
+}
+
+DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::Coeffs
+DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::linearInterpolationCoeffs(const Point2D &x) const
 {
-    _A.resize(nReconstructionPoints(), 3);
+    System A;
 
     int i = 0;
     for(const Cell *cell: _cells)
     {
         const Point2D &x = cell->centroid();
-        _A.setRow(i++, {x.x, x.y, 1.});
+        setRow(A, i++, {x.x, x.y, 1.});
     }
 
     for(const CompatPoint &cpt: _compatPts)
     {
         const Point2D &x = cpt.pt();
-        _A.setRow(i++, {x.x, x.y, 1.});
+        setRow(A, i++, {x.x, x.y, 1.});
     }
 
     for(const Face *face: _faces)
     {
         const Point2D &x = face->centroid();
-        _A.setRow(i++, {x.x, x.y, 1.});
+        setRow(A, i++, {x.x, x.y, 1.});
     }
 
-    _b.resize(1, 3);
-    _b.setRow(0, {x.x, x.y, 1.});
-    _A.pinvert();
+    StaticMatrix<2, 12> b;
+    setRow(b, 0, {x.x, x.y, 1.});
 
-    return _b * _A;
+    return pinvCoeffs(A, i, 3, b, 1);
 }
 
-Matrix DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::quadraticInterpolationCoeffs(const Point2D &x) const
+DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::Coeffs
+DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::quadraticInterpolationCoeffs(const Point2D &x) const
 {
-    _A.resize(nReconstructionPoints(), 6);
+    System A;
 
     int i = 0;
     for(const Cell *cell: _cells)
     {
         const Point2D &x = cell->centroid();
-        _A.setRow(i++, {x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1.});
+        setRow(A, i++, {x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1.});
     }
 
     for(const CompatPoint &cpt: _compatPts)
     {
         const Point2D &x = cpt.pt();
-        _A.setRow(i++, {x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1.});
+        setRow(A, i++, {x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1.});
     }
 
     for(const Face *face: _faces)
     {
         const Point2D &x = face->centroid();
-        _A.setRow(i++, {x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1.});
+        setRow(A, i++, {x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1.});
     }
 
-    _b.resize(1, 6);
-    _b.setRow(0, {x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1.});
-    _A.pinvert();
+    StaticMatrix<2, 12> b;
+    setRow(b, 0, {x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1.});
 
-    return _b * _A;
+    return pinvCoeffs(A, i, 6, b, 1);
 }
 
-Matrix DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::subgridInterpolationCoeffs(const Point2D &x) const
+DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::Coeffs
+DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::subgridInterpolationCoeffs(const Point2D &x) const
 {
     Point2D pt1 = _compatPts[0].pt();
     Point2D pt2 = _compatPts[1].pt();
@@ -156,82 +240,86 @@ Matrix DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::subgridInter
 
     Scalar g = l2 / (l1 + l2);
 
-    return Matrix(1, 2, {g, 1. - g});
+    Coeffs coeffs;
+    coeffs(0, 0) = g;
+    coeffs(0, 1) = 1. - g;
+
+    return coeffs;
 }
 
-Matrix DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::quadraticContinuityConstrainedInterpolationCoeffs(const Point2D &x) const
+DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::Coeffs
+DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::quadraticContinuityConstrainedInterpolationCoeffs(const Point2D &x) const
 {
-    _A.resize(2 * nReconstructionPoints() + 1, 12);
+    System A;
 
     int i = 0;
     for(const Cell *cell: _cells)
     {
         const Point2D &x = cell->centroid();
-        _A.setRow(i++, {x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1., 0., 0., 0., 0., 0., 0.});
-        _A.setRow(i++, {0., 0., 0., 0., 0., 0., x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1.});
+        setRow(A, i++, {x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1., 0., 0., 0., 0., 0., 0.});
+        setRow(A, i++, {0., 0., 0., 0., 0., 0., x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1.});
     }
 
     for(const CompatPoint &cpt: _compatPts)
     {
         const Point2D &x = cpt.pt();
-        _A.setRow(i++, {x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1., 0., 0., 0., 0., 0., 0.});
-        _A.setRow(i++, {0., 0., 0., 0., 0., 0., x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1.});
+        setRow(A, i++, {x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1., 0., 0., 0., 0., 0., 0.});
+        setRow(A, i++, {0., 0., 0., 0., 0., 0., x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1.});
     }
 
     for(const Face *face: _faces)
     {
         const Point2D &x = face->centroid();
-        _A.setRow(i++, {x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1., 0., 0., 0., 0., 0., 0.});
-        _A.setRow(i++, {0., 0., 0., 0., 0., 0., x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1.});
+        setRow(A, i++, {x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1., 0., 0., 0., 0., 0., 0.});
+        setRow(A, i++, {0., 0., 0., 0., 0., 0., x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1.});
     }
 
-    _A.setRow(i, {2 * x.x, 0., x.y, 1., 0., 0.,
-                  0., 2 * x.y, x.x, 0., 1., 0.});
+    setRow(A, i++, {2 * x.x, 0., x.y, 1., 0., 0.,
+                   0., 2 * x.y, x.x, 0., 1., 0.});
 
-    _b.resize(2, 12);
-    _b.setRow(0, {x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1., 0., 0., 0., 0., 0., 0.});
-    _b.setRow(1, {0., 0., 0., 0., 0., 0., x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1.});
-    _A.pinvert();
+    StaticMatrix<2, 12> b;
+    setRow(b, 0, {x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1., 0., 0., 0., 0., 0., 0.});
+    setRow(b, 1, {0., 0., 0., 0., 0., 0., x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1.});
 
-    return _b * _A;
+    return pinvCoeffs(A, i, 12, b, 2);
 }
 
-Matrix DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::polarQuadraticContinuityConstrainedInterpolationCoeffs(const Point2D &x) const
+DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::Coeffs
+DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::polarQuadraticContinuityConstrainedInterpolationCoeffs(const Point2D &x) const
 {
-    _A.resize(2 * nReconstructionPoints() + 1, 12);
+    System A;
 
     int i = 0;
     for(const Cell *cell: _cells)
     {
         const Point2D &x = cell->centroid();
-        _A.setRow(i++, {x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1., 0., 0., 0., 0., 0., 0.});
-        _A.setRow(i++, {0., 0., 0., 0., 0., 0., x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1.});
+        setRow(A, i++, {x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1., 0., 0., 0., 0., 0., 0.});
+        setRow(A, i++, {0., 0., 0., 0., 0., 0., x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1.});
     }
 
     for(const CompatPoint &cpt: _compatPts)
     {
         const Point2D &x = cpt.pt();
-        _A.setRow(i++, {x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1., 0., 0., 0., 0., 0., 0.});
-        _A.setRow(i++, {0., 0., 0., 0., 0., 0., x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1.});
+        setRow(A, i++, {x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1., 0., 0., 0., 0., 0., 0.});
+        setRow(A, i++, {0., 0., 0., 0., 0., 0., x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1.});
     }
 
     for(const Face *face: _faces)
     {
         const Point2D &x = face->centroid();
-        _A.setRow(i++, {x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1., 0., 0., 0., 0., 0., 0.});
-        _A.setRow(i++, {0., 0., 0., 0., 0., 0., x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1.});
+        setRow(A, i++, {x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1., 0., 0., 0., 0., 0., 0.});
+        setRow(A, i++, {0., 0., 0., 0., 0., 0., x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1.});
     }
 
     Scalar r = x.x;
     Scalar z = x.y;
 
-    _A.setRow(i, {3. * r * r / r, z * z / r, 2. * r * z / r, 2. * r / r, z / r, 1. / r,
-                  0., 2 * z, r, 0., 1., 0.});
+    setRow(A, i++, {3. * r * r / r, z * z / r, 2. * r * z / r, 2. * r / r, z / r, 1. / r,
+                   0., 2 * z, r, 0., 1., 0.});
 
-    _b.resize(2, 12);
-    _b.setRow(0, {x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1., 0., 0., 0., 0., 0., 0.});
-    _b.setRow(1, {0., 0., 0., 0., 0., 0., x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1.});
-    _A.pinvert();
+    StaticMatrix<2, 12> b;
+    setRow(b, 0, {x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1., 0., 0., 0., 0., 0., 0.});
+    setRow(b, 1, {0., 0., 0., 0., 0., 0., x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1.});
 
-    return _b * _A;
+    return pinvCoeffs(A, i, 12, b, 2);
 }
@@ -47,6 +47,15 @@ public:
         Point2D _pt;
     };
 
+    //- Maximum number of reconstruction points, and the interpolation coefficients which are stored on the stack. The
+    //- continuity constrained coefficients have two columns per point and one for the constraint
+    enum
+    {
+        MAX_POINTS = 24
+    };
+
+    typedef StaticMatrix<2, 2 * MAX_POINTS + 1> Coeffs;
+
     LeastSquaresQuadraticStencil(const Cell &cell,
                                  const DirectForcingImmersedBoundary &ib);
 
@@ -62,32 +71,37 @@ public:
     const StaticVector<CompatPoint, 8> &compatPts() const
     { return _compatPts; }
 
-    //
-    Matrix interpolationCoeffs(const Point2D &x) const;
+    //- All ib objects that influenced the stencil, the stencil must be rebuilt if any of them move
+    const StaticVector<const ImmersedBoundaryObject*, 8> &ibObjs() const
+    { return _ibObjs; }
 
-    Matrix continuityConstrainedInterpolationCoeffs(const Point2D &pt) const;
+    //- Coefficients are computed without modifying the stencil, so stencils may be used concurrently
+    Coeffs interpolationCoeffs(const Point2D &x) const;
 
-    Matrix polarQuadraticContinuityConstrainedInterpolationCoeffs(const Point2D &x) const;
+    Coeffs continuityConstrainedInterpolationCoeffs(const Point2D &pt) const;
 
-protected:
+    Coeffs polarQuadraticContinuityConstrainedInterpolationCoeffs(const Point2D &x) const;
 
-    static std::vector<std::vector<const ImmersedBoundaryObject*>> _ibObjSets;
+protected:
 
-    static Matrix _A, _b;
+    //- Throws if the stencil is influenced by more ib objects than can be stored
+    void addIbObj(const ImmersedBoundaryObject *ibObj);
 
-    Matrix linearInterpolationCoeffs(const Point2D &x) const;
+    Coeffs linearInterpolationCoeffs(const Point2D &x) const;
 
-    Matrix quadraticInterpolationCoeffs(const Point2D &x) const;
+    Coeffs quadraticInterpolationCoeffs(const Point2D &x) const;
 
-    Matrix subgridInterpolationCoeffs(const Point2D &x) const;
+    Coeffs subgridInterpolationCoeffs(const Point2D &x) const;
 
-    Matrix quadraticContinuityConstrainedInterpolationCoeffs(const Point2D &x) const;
+    Coeffs quadraticContinuityConstrainedInterpolationCoeffs(const Point2D &x) const;
 
     StaticVector<const Cell*, 8> _cells;
 
     StaticVector<const Face*, 8> _faces;
 
     StaticVector<CompatPoint, 8> _compatPts;
+
+    StaticVector<const ImmersedBoundaryObject*, 8> _ibObjs;
 };
 
 #endif
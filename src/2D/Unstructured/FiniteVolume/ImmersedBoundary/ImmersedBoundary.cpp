@@ -1,4 +1,7 @@
 #include <fstream>
+#include <exception>
+
+#include "System/BinaryStream.h"
 
 #include "FiniteVolume/Motion/TranslatingMotion.h"
 #include "FiniteVolume/Motion/OscillatingMotion.h"
@@ -187,6 +190,8 @@ ImmersedBoundary::ImmersedBoundary(const Input &input,
     }
 
 
+    updateIbObjTree();
+
     //- Collision model
     collisionModel_ = std::make_shared<CollisionModel>(
                 input.boundaryInput().get<Scalar>("ImmersedBoundaryCollisions.stiffness", 1e-4),
@@ -222,18 +227,17 @@ CellGroup ImmersedBoundary::solidCells() const
 
 std::shared_ptr<ImmersedBoundaryObject> ImmersedBoundary::ibObj(const Point2D &pt)
 {
-    for (const auto &ibObj: ibObjs_)
-        if (ibObj->isInIb(pt))
-            return ibObj;
-
-    return nullptr;
+    return std::const_pointer_cast<ImmersedBoundaryObject>(static_cast<const ImmersedBoundary&>(*this).ibObj(pt));
 }
 
 std::shared_ptr<const ImmersedBoundaryObject> ImmersedBoundary::ibObj(const Point2D &pt) const
 {
-    for (const auto &ibObj: ibObjs_)
-        if (ibObj->isInIb(pt))
-            return ibObj;
+    std::vector<Label> candidates;
+    ibObjCandidates(pt, candidates);
+
+    for (Label id: candidates)
+        if (ibObjs_[id]->isInIb(pt))
+            return ibObjs_[id];
 
     return nullptr;
 }
@@ -250,10 +254,14 @@ std::shared_ptr<const ImmersedBoundaryObject> ImmersedBoundary::ibObj(const Cell
 
 const std::vector<std::shared_ptr<const ImmersedBoundaryObject> > &ImmersedBoundary::findAllIbObjs(const Point2D &pt) const
 {
+    std::vector<Label> candidates;
+    ibObjCandidates(pt, candidates);
+
     query_.clear();
 
-    std::copy_if(ibObjs_.begin(), ibObjs_.end(), std::back_inserter(query_),
-                 [&pt](const std::shared_ptr<ImmersedBoundaryObject> &ibObj) { return ibObj->isInIb(pt); });
+    for (Label id: candidates)
+        if (ibObjs_[id]->isInIb(pt))
+            query_.push_back(ibObjs_[id]);
 
     return query_;
 }
@@ -270,8 +278,18 @@ ImmersedBoundary::nearestIntersect(const Point2D &pt) const
     Point2D minXc;
     Scalar minDistSqr = std::numeric_limits<Scalar>::infinity();
 
-    for (const auto &ibObj: *this)
+    if (ibObjs_.empty())
+        return std::make_pair(nearestIbObj, minXc);
+
+    //- Objects are visited in order of the distance to their bounding boxes, which bounds the distance to the object
+    for (auto it = ibObjTree_.qbegin(boost::geometry::index::nearest(pt, ibObjs_.size())); it != ibObjTree_.qend(); ++it)
     {
+        Scalar boxDist = boost::geometry::distance(pt, it->first);
+
+        if (boxDist * boxDist > minDistSqr)
+            break;
+
+        const auto &ibObj = ibObjs_[it->second];
         Point2D xc = ibObj->nearestIntersect(pt);
         Scalar distSqr = (xc - pt).magSqr();
 
@@ -299,24 +317,56 @@ void ImmersedBoundary::updateIbPositions(Scalar timeStep)
 {
     for(const auto& ibObj: ibObjs_)
         ibObj->updatePosition(timeStep);
+
+    updateIbObjTree();
 }
 
-FiniteVolumeEquation<Vector2D> ImmersedBoundary::velocityBcs(VectorFiniteVolumeField &u) const
+void ImmersedBoundary::writeCheckpoint(std::ostream &os) const
 {
-    FiniteVolumeEquation<Vector2D> eqn(u);
+    binary::write(os, (unsigned long) ibObjs_.size());
 
-    return eqn;
+    for (const auto &ibObj: ibObjs_)
+    {
+        binary::write(os, ibObj->name());
+        ibObj->writeCheckpoint(os);
+    }
 }
 
-bool ImmersedBoundary::isIbCell(const Cell &cell) const
+void ImmersedBoundary::readCheckpoint(std::istream &is)
 {
+    unsigned long nIbObjs;
+    binary::read(is, nIbObjs);
+
+    if (nIbObjs != ibObjs_.size())
+        throw Exception("ImmersedBoundary", "readCheckpoint", "checkpoint has " + std::to_string(nIbObjs)
+                                                              + " immersed boundary objects, case has "
+                                                              + std::to_string(ibObjs_.size()) + ".");
+
     for (const auto &ibObj: ibObjs_)
     {
-        if (ibObj->isInIb(cell.centroid()))
-            return true;
+        std::string name;
+        binary::read(is, name);
+
+        if (name != ibObj->name())
+            throw Exception("ImmersedBoundary", "readCheckpoint", "expected immersed boundary object \""
+                                                                  + ibObj->name() + "\", found \"" + name + "\".");
+
+        ibObj->readCheckpoint(is);
     }
 
-    return false;
+    updateIbObjTree();
+}
+
+FiniteVolumeEquation<Vector2D> ImmersedBoundary::velocityBcs(VectorFiniteVolumeField &u) const
+{
+    FiniteVolumeEquation<Vector2D> eqn(u);
+
+    return eqn;
+}
+
+bool ImmersedBoundary::isIbCell(const Cell &cell) const
+{
+    return (bool) ibObj(cell.centroid());
 }
 
 void ImmersedBoundary::applyHydrodynamicForce(Scalar rho,
@@ -324,15 +374,14 @@ void ImmersedBoundary::applyHydrodynamicForce(Scalar rho,
                                               const VectorFiniteVolumeField &u,
                                               const ScalarFiniteVolumeField &p,
                                               const Vector2D &g)
-{   
+{
     if (collisionModel_)
-        for (auto ibObjP: ibObjs_)
-        {
-            for (auto ibObjQ: ibObjs_)
-                ibObjP->applyForce(collisionModel_->force(*ibObjP, *ibObjQ));
+    {
+        std::vector<Vector2D> fc = collisionForces(true);
 
-            ibObjP->applyForce(collisionModel_->force(*ibObjP, *grid_));
-        }
+        for (Label id = 0; id < ibObjs_.size(); ++id)
+            ibObjs_[id]->applyForce(fc[id]);
+    }
 }
 
 void ImmersedBoundary::applyHydrodynamicForce(const ScalarFiniteVolumeField &rho,
@@ -340,43 +389,35 @@ void ImmersedBoundary::applyHydrodynamicForce(const ScalarFiniteVolumeField &rho
                                               const VectorFiniteVolumeField &u,
                                               const ScalarFiniteVolumeField &p,
                                               const Vector2D &g)
-{   
+{
     if (collisionModel_)
-        for (auto ibObjP: ibObjs_)
-        {
-            for (auto ibObjQ: ibObjs_)
-                ibObjP->applyForce(collisionModel_->force(*ibObjP, *ibObjQ));
+    {
+        std::vector<Vector2D> fc = collisionForces(true);
 
-            ibObjP->applyForce(collisionModel_->force(*ibObjP, *grid_));
-        }
+        for (Label id = 0; id < ibObjs_.size(); ++id)
+            ibObjs_[id]->applyForce(fc[id]);
+    }
 }
 
 void ImmersedBoundary::applyCollisionForce(bool add)
 {
     if(collisionModel_)
-        for (auto ibObjP: ibObjs_)
+    {
+        //- Collisions with particles only, domain boundaries are not included here
+        std::vector<Vector2D> fc = collisionForces(false);
+
+        for (Label id = 0; id < ibObjs_.size(); ++id)
         {
-            //- Dont compute if no motion
-            if(!ibObjP->motion())
+            //- Dont apply if no motion
+            if(!ibObjs_[id]->motion())
                 continue;
 
-            Vector2D fc(0., 0.);
-
-            //- Collisions with particles
-            for (auto ibObjQ: ibObjs_)
-                fc += collisionModel_->force(*ibObjP, *ibObjQ);
-
             if(add)
-                ibObjP->addForce(fc);
+                ibObjs_[id]->addForce(fc[id]);
             else
-                ibObjP->applyForce(fc);
-
-            //- Collisions with domain boundaries
-            //            if(add)
-            //                ibObjP->addForce(collisionModel_->force(*ibObjP, *grid_));
-            //            else
-            //                ibObjP->applyForce(collisionModel_->force(*ibObjP, *grid_));
+                ibObjs_[id]->applyForce(fc[id]);
         }
+    }
 }
 
 
@@ -394,3 +435,104 @@ void ImmersedBoundary::setCellStatus()
 
     grid_->sendMessages(*cellStatus_);
 }
+
+void ImmersedBoundary::updateIbObjTree()
+{
+    std::vector<IbObjBox> boxes;
+    boxes.reserve(ibObjs_.size());
+
+    for (Label id = 0; id < ibObjs_.size(); ++id)
+        boxes.push_back(std::make_pair(ibObjs_[id]->shape().boundingBox(), id));
+
+    //- Bulk loading packs the tree, which is cheaper than updating the boxes in place for a few hundred objects
+    ibObjTree_ = decltype(ibObjTree_)(boxes.begin(), boxes.end());
+}
+
+void ImmersedBoundary::ibObjCandidates(const Point2D &pt, std::vector<Label> &candidates) const
+{
+    for (auto it = ibObjTree_.qbegin(boost::geometry::index::intersects(pt)); it != ibObjTree_.qend(); ++it)
+        candidates.push_back(it->second);
+
+    std::sort(candidates.begin(), candidates.end());
+}
+
+void ImmersedBoundary::collisionPairs(std::vector<std::pair<Label, Label>> &pairs) const
+{
+    namespace bgi = boost::geometry::index;
+
+    Scalar range = collisionModel_ ? collisionModel_->range() : 0.;
+
+    for (Label i = 0; i < ibObjs_.size(); ++i)
+    {
+        auto box = ibObjs_[i]->shape().boundingBox();
+        box.min_corner() -= Vector2D(range, range);
+        box.max_corner() += Vector2D(range, range);
+
+        for (auto it = ibObjTree_.qbegin(bgi::intersects(box)); it != ibObjTree_.qend(); ++it)
+            if (it->second > i)
+                pairs.push_back(std::make_pair(i, it->second));
+    }
+}
+
+std::vector<Vector2D> ImmersedBoundary::collisionForces(bool walls) const
+{
+    std::vector<Vector2D> fc(ibObjs_.size(), Vector2D(0., 0.));
+
+    if (!collisionModel_)
+        return fc;
+
+    std::vector<std::pair<Label, Label>> pairs;
+    collisionPairs(pairs);
+
+    //- Exceptions cannot leave the parallel region, so the first one is kept and rethrown after it
+    std::exception_ptr error;
+
+    auto keepError = [&error]()
+    {
+#pragma omp critical
+        if (!error)
+            error = std::current_exception();
+    };
+
+#pragma omp parallel
+    {
+        std::vector<Vector2D> fcLocal(ibObjs_.size(), Vector2D(0., 0.));
+
+        //- The collision force is antisymmetric, so each candidate pair is evaluated once
+#pragma omp for nowait
+        for (Label k = 0; k < pairs.size(); ++k)
+            try
+            {
+                Vector2D f = collisionModel_->force(*ibObjs_[pairs[k].first], *ibObjs_[pairs[k].second]);
+                fcLocal[pairs[k].first] += f;
+                fcLocal[pairs[k].second] -= f;
+            }
+            catch (...)
+            {
+                keepError();
+            }
+
+        if (walls)
+        {
+#pragma omp for nowait
+            for (Label id = 0; id < ibObjs_.size(); ++id)
+                try
+                {
+                    fcLocal[id] += collisionModel_->force(*ibObjs_[id], *grid_);
+                }
+                catch (...)
+                {
+                    keepError();
+                }
+        }
+
+#pragma omp critical
+        for (Label id = 0; id < ibObjs_.size(); ++id)
+            fc[id] += fcLocal[id];
+    }
+
+    if (error)
+        std::rethrow_exception(error);
+
+    return fc;
+}
@@ -1,6 +1,8 @@
 #ifndef PHASE_IMMERSED_BOUNDARY_H
 #define PHASE_IMMERSED_BOUNDARY_H
 
+#include <boost/geometry/index/rtree.hpp>
+
 #include "FiniteVolume/Field/ScalarFiniteVolumeField.h"
 #include "FiniteVolume/Field/VectorFiniteVolumeField.h"
 #include "FiniteVolume/Equation/FiniteVolumeEquation.h"
@@ -66,6 +68,11 @@ public:
 
     virtual void updateCells() = 0;
 
+    //- Checkpoints, reading restores the object states only, as reclassifying the cells with updateCells is collective
+    void writeCheckpoint(std::ostream &os) const;
+
+    void readCheckpoint(std::istream &is);
+
     //- Boundary conditions
     template<class T>
     void copyBoundaryConditions(const FiniteVolumeField<T> &srcField, const FiniteVolumeField<T> &destField)
@@ -106,6 +113,18 @@ protected:
 
     void setCellStatus();
 
+    //- Rebuilds the bounding box tree over the ib objects, must be called whenever the objects move
+    void updateIbObjTree();
+
+    //- Collects the indices of the ib objects whose bounding boxes contain pt, in the order of ibObjs_
+    void ibObjCandidates(const Point2D &pt, std::vector<Label> &candidates) const;
+
+    //- Broad phase, collects each pair (i < j) of ib objects whose bounding boxes are within the collision range
+    void collisionPairs(std::vector<std::pair<Label, Label>> &pairs) const;
+
+    //- Net collision force on each ib object, the pair forces are evaluated once and applied to both objects
+    std::vector<Vector2D> collisionForces(bool walls) const;
+
     std::shared_ptr<CellGroup> domainCells_;
 
     std::shared_ptr<FiniteVolumeField<int>> cellStatus_;
@@ -114,6 +133,11 @@ protected:
 
     std::vector<std::shared_ptr<ImmersedBoundaryObject>> ibObjs_;
 
+    //- Bounding boxes of the ib objects, paired with their index in ibObjs_
+    typedef std::pair<boost::geometry::model::box<Point2D>, Label> IbObjBox;
+
+    boost::geometry::index::rtree<IbObjBox, boost::geometry::index::quadratic<8, 4>> ibObjTree_;
+
     //- Collision model
     std::shared_ptr<CollisionModel> collisionModel_;
 };
@@ -1,4 +1,5 @@
 #include "System/NotImplementedException.h"
+#include "System/BinaryStream.h"
 
 #include "ImmersedBoundaryObject.h"
 #include "ImmersedBoundary.h"
@@ -43,6 +44,22 @@ bool ImmersedBoundaryObject::addSolidCell(const Cell &cell)
     return false;
 }
 
+void ImmersedBoundaryObject::removeCells(const CellSet &cells)
+{
+    CellSet ownCells;
+
+    for(const Cell &cell: cells)
+        if(_cells.isInSet(cell))
+            ownCells.add(cell);
+
+    if(ownCells.empty())
+        return;
+
+    _cells.remove(ownCells);
+    _ibCells.remove(ownCells);
+    _solidCells.remove(ownCells);
+}
+
 void ImmersedBoundaryObject::clear()
 {
     _cells.clear();
@@ -191,3 +208,24 @@ void ImmersedBoundaryObject::updatePosition(Scalar timeStep)
         _shape->move(_motion->position());
     }
 }
+
+void ImmersedBoundaryObject::writeCheckpoint(std::ostream &os) const
+{
+    binary::write(os, _force);
+    binary::write(os, _torque);
+
+    if (_motion)
+        _motion->writeCheckpoint(os);
+}
+
+void ImmersedBoundaryObject::readCheckpoint(std::istream &is)
+{
+    binary::read(is, _force);
+    binary::read(is, _torque);
+
+    if (_motion)
+    {
+        _motion->readCheckpoint(is);
+        _shape->move(_motion->position());
+    }
+}
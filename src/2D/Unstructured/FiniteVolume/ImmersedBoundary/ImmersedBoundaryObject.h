@@ -7,6 +7,7 @@
 #include "Geometry/Tensor2D.h"
 #include "FiniteVolume/Motion/Motion.h"
 #include "FiniteVolumeGrid2D/Cell/CellGroup.h"
+#include "FiniteVolumeGrid2D/Cell/CellSet.h"
 
 class ImmersedBoundaryObject
 {
@@ -49,6 +50,9 @@ public:
 
     bool addSolidCell(const Cell &cell);
 
+    //- Removes any of the given cells that belong to this object
+    void removeCells(const CellSet &cells);
+
     void clear();
 
     //- Geometry related methods
@@ -160,6 +164,11 @@ public:
     //- Update
     void updatePosition(Scalar timeStep);
 
+    //- Checkpoints of the force and motion state, reading moves the shape to the restored position
+    void writeCheckpoint(std::ostream &os) const;
+
+    void readCheckpoint(std::istream &is);
+
     //- Public properties
     Scalar rho = 0.;
 
@@ -1,3 +1,5 @@
+#include "System/BinaryStream.h"
+
 #include "Motion.h"
 
 Motion::Motion(const Point2D &pos,
@@ -26,3 +28,23 @@ void Motion::init(const Point2D &pos, const Vector2D &vel, const Vector2D &acc,
     omega_ = omega;
     alpha_ = alpha;
 }
+
+void Motion::writeCheckpoint(std::ostream &os) const
+{
+    binary::write(os, pos_);
+    binary::write(os, vel_);
+    binary::write(os, acc_);
+    binary::write(os, theta_);
+    binary::write(os, omega_);
+    binary::write(os, alpha_);
+}
+
+void Motion::readCheckpoint(std::istream &is)
+{
+    binary::read(is, pos_);
+    binary::read(is, vel_);
+    binary::read(is, acc_);
+    binary::read(is, theta_);
+    binary::read(is, omega_);
+    binary::read(is, alpha_);
+}
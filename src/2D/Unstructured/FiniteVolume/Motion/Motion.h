@@ -1,6 +1,9 @@
 #ifndef PHASE_MOTION_H
 #define PHASE_MOTION_H
 
+#include <istream>
+#include <ostream>
+
 #include "Geometry/Point2D.h"
 
 class Motion
@@ -47,6 +50,11 @@ public:
     Scalar theta() const
     { return theta_; }
 
+    //- Checkpoints, derived motions append any state they integrate in time
+    virtual void writeCheckpoint(std::ostream &os) const;
+
+    virtual void readCheckpoint(std::istream &is);
+
 protected:
 
     Scalar alpha_, omega_, theta_;
@@ -1,3 +1,5 @@
+#include "System/BinaryStream.h"
+
 #include "MotionProfile.h"
 #include "TranslatingMotion.h"
 #include "OscillatingMotion.h"
@@ -39,3 +41,21 @@ void MotionProfile::addMotion(Scalar startTime, const std::shared_ptr<Motion> &m
     timePoints_.push_back(TimePoint{startTime, motion});
     std::sort(timePoints_.begin(), timePoints_.end());
 }
+
+void MotionProfile::writeCheckpoint(std::ostream &os) const
+{
+    Motion::writeCheckpoint(os);
+    binary::write(os, time_);
+
+    for (const TimePoint &tp: timePoints_)
+        tp.motion->writeCheckpoint(os);
+}
+
+void MotionProfile::readCheckpoint(std::istream &is)
+{
+    Motion::readCheckpoint(is);
+    binary::read(is, time_);
+
+    for (const TimePoint &tp: timePoints_)
+        tp.motion->readCheckpoint(is);
+}
@@ -16,6 +16,10 @@ public:
 
     virtual void update(Scalar timeStep) override;
 
+    virtual void writeCheckpoint(std::ostream &os) const override;
+
+    virtual void readCheckpoint(std::istream &is) override;
+
     void addMotion(Scalar startTime, const std::shared_ptr<Motion> &motion);
 
 protected:
@@ -1,3 +1,5 @@
+#include "System/BinaryStream.h"
+
 #include "FiniteVolume/ImmersedBoundary/ImmersedBoundaryObject.h"
 
 #include "OscillatingMotion.h"
@@ -28,3 +30,15 @@ void OscillatingMotion::update(Scalar timeStep)
     acc_ = Vector2D(-amp_.x * std::pow(omega.x, 2) * std::sin(omega.x * time_), -amp_.y * std::pow(omega.y, 2) * std::sin(omega.y * time_));
     //ibObj_.lock()->shape().move(x);
 }
+
+void OscillatingMotion::writeCheckpoint(std::ostream &os) const
+{
+    Motion::writeCheckpoint(os);
+    binary::write(os, time_);
+}
+
+void OscillatingMotion::readCheckpoint(std::istream &is)
+{
+    Motion::readCheckpoint(is);
+    binary::read(is, time_);
+}
@@ -15,6 +15,10 @@ public:
 
     void update(Scalar timeStep);
 
+    void writeCheckpoint(std::ostream &os) const;
+
+    void readCheckpoint(std::istream &is);
+
 private:
 
     Point2D pos0_;
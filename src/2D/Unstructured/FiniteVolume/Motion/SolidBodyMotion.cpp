@@ -1,3 +1,5 @@
+#include "System/BinaryStream.h"
+
 #include "SolidBodyMotion.h"
 
 SolidBodyMotion::SolidBodyMotion(std::weak_ptr<const ImmersedBoundaryObject> ibObj,
@@ -54,3 +56,17 @@ void SolidBodyMotion::setMotionConstraint(const Vector2D &axis)
     acc_ = dot(acc_, motionAxis_) * motionAxis_;
     vel_ = dot(vel_, motionAxis_) * motionAxis_;
 }
+
+void SolidBodyMotion::writeCheckpoint(std::ostream &os) const
+{
+    Motion::writeCheckpoint(os);
+    binary::write(os, force_);
+    binary::write(os, torque_);
+}
+
+void SolidBodyMotion::readCheckpoint(std::istream &is)
+{
+    Motion::readCheckpoint(is);
+    binary::read(is, force_);
+    binary::read(is, torque_);
+}
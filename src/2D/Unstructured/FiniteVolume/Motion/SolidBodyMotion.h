@@ -16,6 +16,10 @@ public:
 
     void update(Scalar timeStep);
 
+    void writeCheckpoint(std::ostream &os) const;
+
+    void readCheckpoint(std::istream &is);
+
     void setMotionConstraint(const Vector2D &axis);
 
 private:
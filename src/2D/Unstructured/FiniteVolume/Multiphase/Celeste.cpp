@@ -1,16 +1,20 @@
+#include <cmath>
+
 #include "Celeste.h"
 
 Celeste::Celeste(const Input &input,
                  const std::shared_ptr<const FiniteVolumeGrid2D> &grid,
                  const std::shared_ptr<CellGroup> &fluidCells)
     :
-      SurfaceTensionForce(input, grid, fluidCells)
+      SurfaceTensionForce(input, grid, fluidCells),
+      band_(grid, input.caseInput().get<int>("Solver.narrowBandLayers", defaultNarrowBandLayers()))
 {
     computeStencils();
 }
 
 void Celeste::computeFaceInterfaceForces(const ScalarFiniteVolumeField &gamma, const ScalarGradient &gradGamma)
 {
+    updateNarrowBand(gamma);
     computeGradGammaTilde(gamma);
     computeInterfaceNormals();
     computeCurvature();
@@ -18,12 +22,13 @@ void Celeste::computeFaceInterfaceForces(const ScalarFiniteVolumeField &gamma, c
     auto &fst = *fst_;
     auto &kappa = *kappa_;
 
-    for (const Face &face: fst.grid()->faces())
+    for (const Face &face: band_.faces())
         fst(face) = sigma_ * kappa(face) * gradGamma(face);
 }
 
 void Celeste::computeInterfaceForces(const ScalarFiniteVolumeField &gamma, const ScalarGradient &gradGamma)
 {
+    updateNarrowBand(gamma);
     computeGradGammaTilde(gamma);
     computeInterfaceNormals();
     computeCurvature();
@@ -31,26 +36,61 @@ void Celeste::computeInterfaceForces(const ScalarFiniteVolumeField &gamma, const
     auto &fst = *fst_;
     auto &kappa = *kappa_;
 
-    fst.fill(Vector2D(0., 0.));
-
-    for (const Cell &cell: fst.cells())
+    for (const Cell &cell: band_.innerCells())
         fst(cell) = sigma_ * kappa(cell) * gradGamma(cell);
 }
 
 //- Protected methods
 
+void Celeste::updateNarrowBand(const ScalarFiniteVolumeField &gamma)
+{
+    auto &gammaTilde = *gammaTilde_;
+    auto &gradGammaTilde = *gradGammaTilde_;
+    auto &n = *n_;
+    auto &kappa = *kappa_;
+    auto &fst = *fst_;
+
+    //- Away from the interface gamma is constant, so it is its own smoothed value
+    if (band_.update(gamma, *fluid_))
+        for (const Cell &cell: *fluid_)
+            gammaTilde(cell) = gamma(cell);
+
+    for (const Cell &cell: band_.oldCells())
+    {
+        gammaTilde(cell) = gamma(cell);
+        gradGammaTilde(cell) = Vector2D(0., 0.);
+        n(cell) = Vector2D(0., 0.);
+        kappa(cell) = 0.;
+        fst(cell) = Vector2D(0., 0.);
+    }
+
+    for (const Face &face: band_.oldFaces())
+    {
+        n(face) = Vector2D(0., 0.);
+        kappa(face) = 0.;
+        fst(face) = Vector2D(0., 0.);
+    }
+}
+
 void Celeste::computeGradGammaTilde(const ScalarFiniteVolumeField &gamma)
 {
-    smoothGammaField(gamma);
+    smoothGammaField(gamma, band_.cells());
 
     auto &gammaTilde = *gammaTilde_;
     auto &gradGammaTilde = *gradGammaTilde_;
 
-    gradGammaTilde.fill(Vector2D(0., 0.));
-    for (const Cell &cell: *fluid_)
-        gradGammaTilde(cell) = gradGammaTildeStencils_[cell.id()].grad(gammaTilde);
+    //- Cells needed by other procs are computed first, the rest are computed while the exchange is in flight
+    for (const Cell &cell: band_.innerCells())
+        if (grid_->isNearHalo(cell))
+            gradGammaTilde(cell) = gradGammaTildeStencils_[cell.id()].grad(gammaTilde);
+
+    gradGammaTilde.beginExchange();
+
+    for (const Cell &cell: band_.innerCells())
+        if (!grid_->isNearHalo(cell))
+            gradGammaTilde(cell) = gradGammaTildeStencils_[cell.id()].grad(gammaTilde);
 
-    gradGammaTilde.sendMessages();
+    gradGammaTilde.endExchange();
 }
 
 void Celeste::computeCurvature()
@@ -74,18 +114,17 @@ void Celeste::computeCurvature()
         return true;
     };
 
-    for (const Cell &cell: kappa.cells())
+    auto computeKappa = [this, &n, &kappa, &validCurvature](const Cell &cell)
+    {
         if (validCurvature(cell))
             kappa(cell) = kappaStencils_[cell.id()].kappa(n);
         else
             kappa(cell) = 0.;
+    };
 
-    kappa.sendMessages();
-
-    for (const Face &face: kappa.grid()->interiorFaces())
+    //- According to Afkhami 2007
+    auto interpolateKappa = [&n, &kappa](const Face &face)
     {
-        //- According to Afkhami 2007
-
         if(n(face.lCell()).magSqr() != 0. && n(face.rCell()).magSqr() != 0.)
         {
             Scalar g = face.volumeWeight();
@@ -97,10 +136,31 @@ void Celeste::computeCurvature()
             kappa(face) = kappa(face.rCell());
         else
             kappa(face) = 0.;
-    }
+    };
+
+    //- Overlap the halo exchange with the interior cells and the faces between local cells
+    for (const Cell &cell: band_.innerCells())
+        if (grid_->isNearHalo(cell))
+            computeKappa(cell);
+
+    kappa.beginExchange();
+
+    for (const Cell &cell: band_.innerCells())
+        if (!grid_->isNearHalo(cell))
+            computeKappa(cell);
+
+    for (const Face &face: band_.faces())
+        if (grid_->innerFaces().isInSet(face))
+            interpolateKappa(face);
 
-    for(const Face &face: kappa.grid()->boundaryFaces())
-        if(n(face.lCell()).magSqr() != 0.)
+    kappa.endExchange();
+
+    for (const Face &face: band_.faces())
+        if (grid_->nearHaloFaces().isInSet(face))
+            interpolateKappa(face);
+
+    for (const Face &face: band_.faces())
+        if (face.isBoundary() && n(face.lCell()).magSqr() != 0.)
             kappa(face) = kappa(face.lCell());
 }
 
@@ -116,3 +176,19 @@ void Celeste::computeStencils()
     for (const Cell &cell: gradGammaTilde_->grid()->cells())
         gradGammaTildeStencils_[cell.id()] = Stencil(cell, true);
 }
+
+//- Private methods
+
+int Celeste::defaultNarrowBandLayers() const
+{
+    Scalar h = std::numeric_limits<Scalar>::infinity();
+
+    for (const Cell &cell: *fluid_)
+        for (const CellLink &nb: cell.cellLinks())
+            h = std::min(h, nb.rCellVec().mag());
+
+    h = grid_->comm().min(h);
+
+    //- Kernel reach, plus one layer each for the gradient and curvature stencils and one to keep the edge clear
+    return (int) std::ceil(kernelWidth_ / h) + 3;
+}
@@ -5,6 +5,7 @@
 #include "Math/Matrix.h"
 
 #include "SurfaceTensionForce.h"
+#include "NarrowBand.h"
 
 class Celeste : public SurfaceTensionForce
 {
@@ -64,6 +65,12 @@ protected:
         std::vector<Ref<const Face>> faces_;
     };
 
+    //- Rebuilds the narrow band and clears the surface tension fields on the cells and faces of the old band
+    void updateNarrowBand(const ScalarFiniteVolumeField &gamma);
+
+    const CellSet &interfaceCells() const override
+    { return band_.innerCells(); }
+
     void computeGradGammaTilde(const ScalarFiniteVolumeField &gamma);
 
     virtual void computeCurvature();
@@ -71,6 +78,14 @@ protected:
     virtual void computeStencils();
 
     std::vector<Stencil> kappaStencils_, gradGammaTildeStencils_;
+
+    //- Surface tension is only computed within this band, the fields are zero elsewhere
+    NarrowBand band_;
+
+private:
+
+    //- Enough layers for the smoothing kernel and the gradient and curvature stencils
+    int defaultNarrowBandLayers() const;
 };
 
 #endif
@@ -31,7 +31,7 @@ void CelesteAxisymmetricImmersedBoundary::computeCurvature()
         return true;
     };
 
-    for (const Cell &cell: kappa.cells())
+    for (const Cell &cell: band_.innerCells())
         if (validCurvature(cell))
             kappa(cell) = kappaStencils_[cell.id()].axiDiv(n);
         else
@@ -40,8 +40,11 @@ void CelesteAxisymmetricImmersedBoundary::computeCurvature()
     kappa.sendMessages();
 
     auto ib = ib_.lock();
-    for (const Face &face: kappa.grid()->interiorFaces())
-    {   
+    for (const Face &face: band_.faces())
+    {
+        if (face.isBoundary())
+            continue;
+
         //- According to Afkhami 2007
         if(kappa(face.lCell()) != 0. && kappa(face.rCell()) != 0.)
         {
@@ -56,7 +59,7 @@ void CelesteAxisymmetricImmersedBoundary::computeCurvature()
             kappa(face) = 0.;
     }
 
-    for(const Face &face: kappa.grid()->boundaryFaces())
-        if(kappa(face.lCell()) != 0.)
+    for(const Face &face: band_.faces())
+        if(face.isBoundary() && kappa(face.lCell()) != 0.)
             kappa(face) = kappa(face.lCell());
 }
@@ -137,7 +137,7 @@ void CelesteImmersedBoundary::applyFluidForces(const ScalarFiniteVolumeField &rh
         Index row = 0;
         for(const Cell &cell: ibObj->ibCells())
         {
-            auto st = DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil(cell, ib);
+            const auto &st = ib.stencil(cell);
 
             //- Compute the stress tensor
             Matrix A(st.nReconstructionPoints(), 6), rhs(st.nReconstructionPoints(), 2);
@@ -462,7 +462,7 @@ void CelesteImmersedBoundary::computeInterfaceNormals()
     const VectorFiniteVolumeField &gradGammaTilde = *gradGammaTilde_;
     VectorFiniteVolumeField &n = *n_;
 
-    for (const Cell &cell: n.grid()->cells())
+    for (const Cell &cell: interfaceCells())
         n(cell) = gradGammaTilde(cell).magSqr() >= eps_ * eps_ ? -gradGammaTilde(cell).unitVec() : Vector2D(0., 0.);
 
     //- Override the ib cells in the contact line region only
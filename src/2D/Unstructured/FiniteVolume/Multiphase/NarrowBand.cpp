@@ -0,0 +1,120 @@
+#include "NarrowBand.h"
+
+NarrowBand::NarrowBand(const std::shared_ptr<const FiniteVolumeGrid2D> &grid, int nLayers)
+    :
+      grid_(grid),
+      nLayers_(nLayers),
+      layer_(grid, "narrowBandLayer", -1, false, false)
+{
+    if(nLayers_ < 1)
+        throw Exception("NarrowBand", "NarrowBand", "the band must have at least one layer.");
+
+    for(const Cell &cell: grid_->localCells())
+        if(!cell.boundaries().empty())
+            edgeCells_.add(cell);
+
+    for(const CellGroup &group: grid_->bufferGroups())
+        for(const Cell &cell: group)
+            for(const CellLink &nb: cell.cellLinks())
+                if(grid_->localCells().isInSet(nb.cell()))
+                    edgeCells_.add(nb.cell());
+}
+
+bool NarrowBand::update(const ScalarFiniteVolumeField &gamma, const CellGroup &cells)
+{
+    std::swap(oldCells_, cells_);
+    std::swap(oldFaces_, faces_);
+
+    innerCells_.clear();
+    cells_.clear();
+    faces_.clear();
+
+    for(const Cell &cell: oldCells_)
+        layer_(cell) = -1;
+
+    bool fullSearch = oldCells_.empty();
+    std::vector<Ref<const Cell>> front;
+
+    auto seed = [this, &gamma, &cells, &front](const Cell &cell)
+    {
+        if(layer_(cell) == -1 && cells.isInSet(cell) && isInterfaceCell(cell, gamma))
+        {
+            layer_(cell) = 0;
+            front.push_back(std::cref(cell));
+        }
+    };
+
+    if(fullSearch)
+        for(const Cell &cell: cells)
+            seed(cell);
+    else
+    {
+        for(const Cell &cell: oldCells_)
+            seed(cell);
+
+        //- An interface entering through an inflow boundary or from another proc is not reached from the old band
+        for(const Cell &cell: edgeCells_)
+            seed(cell);
+    }
+
+    layer_.sendMessages();
+
+    for(int layer = 1; layer <= nLayers_; ++layer)
+    {
+        for(const Cell &cell: front)
+        {
+            innerCells_.add(cell);
+            cells_.add(cell);
+        }
+
+        std::vector<Ref<const Cell>> next;
+
+        auto grow = [this, &cells, &next, layer](const Cell &cell)
+        {
+            for(const CellLink &nb: cell.cellLinks())
+                if(layer_(nb.cell()) == -1 && cells.isInSet(nb.cell()))
+                {
+                    layer_(nb.cell()) = layer;
+                    next.push_back(std::cref(nb.cell()));
+                }
+        };
+
+        for(const Cell &cell: front)
+            grow(cell);
+
+        //- Buffer cells reached by other procs in the previous layer grow the band into this proc
+        for(const CellGroup &group: grid_->bufferGroups())
+            for(const Cell &cell: group)
+                if(layer_(cell) == layer - 1)
+                    grow(cell);
+
+        front = std::move(next);
+        layer_.sendMessages();
+    }
+
+    for(const Cell &cell: front)
+        cells_.add(cell);
+
+    for(const Cell &cell: innerCells_)
+    {
+        for(const InteriorLink &nb: cell.neighbours())
+            faces_.add(nb.face());
+
+        for(const BoundaryLink &bd: cell.boundaries())
+            faces_.add(bd.face());
+    }
+
+    return fullSearch;
+}
+
+bool NarrowBand::isInterfaceCell(const Cell &cell, const ScalarFiniteVolumeField &gamma)
+{
+    if(gamma(cell) > 0. && gamma(cell) < 1.)
+        return true;
+
+    for(const InteriorLink &nb: cell.neighbours())
+        if(gamma(nb.cell()) != gamma(cell))
+            return true;
+
+    return false;
+}
@@ -0,0 +1,61 @@
+#ifndef PHASE_NARROW_BAND_H
+#define PHASE_NARROW_BAND_H
+
+#include "FiniteVolume/Field/ScalarFiniteVolumeField.h"
+#include "FiniteVolumeGrid2D/Cell/CellSet.h"
+
+//- Tracks the local cells within a number of layers of the interface, counted through neighbours and diagonals and
+//- across procs. Interface cells have 0 < gamma < 1 or a neighbour with a different gamma.
+class NarrowBand
+{
+public:
+
+    NarrowBand(const std::shared_ptr<const FiniteVolumeGrid2D> &grid, int nLayers);
+
+    //- Rebuilds the band around the interface cells among cells. Since the interface moves less than a cell per update
+    //- only the previous band is searched, unless it is empty, along with the cells where an interface can enter
+    //- from a boundary or another proc. Returns true if all cells were searched.
+    bool update(const ScalarFiniteVolumeField &gamma, const CellGroup &cells);
+
+    int nLayers() const
+    { return nLayers_; }
+
+    //- Cells of layers 0 to nLayers - 1
+    const CellSet &innerCells() const
+    { return innerCells_; }
+
+    //- Cells of all layers, the last layer only supports the stencils of the inner cells
+    const CellSet &cells() const
+    { return cells_; }
+
+    //- Interior and boundary faces of the inner cells
+    const Set<Face> &faces() const
+    { return faces_; }
+
+    //- Cells and faces of the band before the last update
+    const CellSet &oldCells() const
+    { return oldCells_; }
+
+    const Set<Face> &oldFaces() const
+    { return oldFaces_; }
+
+private:
+
+    static bool isInterfaceCell(const Cell &cell, const ScalarFiniteVolumeField &gamma);
+
+    std::shared_ptr<const FiniteVolumeGrid2D> grid_;
+
+    int nLayers_;
+
+    //- Layer of each cell, -1 outside of the band. Exchanged after each layer so the band can cross proc boundaries
+    FiniteVolumeField<int> layer_;
+
+    CellSet innerCells_, cells_, oldCells_;
+
+    //- Local cells next to a boundary or a buffer cell
+    CellSet edgeCells_;
+
+    Set<Face> faces_, oldFaces_;
+};
+
+#endif
@@ -21,8 +21,7 @@ SurfaceTensionForce::SurfaceTensionForce(const Input &input,
     kernelType_ = getKernelType(input.caseInput().get<std::string>("Solver.kernelType", "pow8"));
     eps_ = input.caseInput().get<Scalar>("Solver.eps", eps_);
 
-    for(const Cell &cell: *fluid_)
-        kernels_.push_back(SmoothingKernel(cell, kernelWidth_, kernelType_));
+    initSmoothingOperator(false);
 
     //- Determine which patches contact angles will be enforced on
     for (const FaceGroup &patch: grid->patches())
@@ -44,7 +43,7 @@ void SurfaceTensionForce::computeInterfaceNormals()
     const VectorFiniteVolumeField &gradGammaTilde = *gradGammaTilde_;
     VectorFiniteVolumeField &n = *n_;
 
-    for (const Cell &cell: *fluid_)
+    for (const Cell &cell: interfaceCells())
         n(cell) = gradGammaTilde(cell).magSqr() >= eps_ * eps_ ? -gradGammaTilde(cell).unitVec() : Vector2D(0., 0.);
 
     n.sendMessages();
@@ -75,8 +74,7 @@ void SurfaceTensionForce::computeInterfaceNormals()
 
 void SurfaceTensionForce::setAxisymmetric(bool axisymmetric)
 {
-    for(auto &k: kernels_)
-        k.setAxisymmetric(axisymmetric);
+    initSmoothingOperator(axisymmetric);
 }
 
 Scalar SurfaceTensionForce::theta(const FaceGroup &patch) const
@@ -90,8 +88,37 @@ void SurfaceTensionForce::smoothGammaField(const ScalarFiniteVolumeField &gamma)
     auto &gammaTilde = *gammaTilde_;
 
     gammaTilde.fill(0.);
-    for(const auto &k: kernels_)
-        gammaTilde(k.cell()) = k.eval(gamma);
+
+#pragma omp parallel for
+    for(Label i = 0; i < smoothingRowPtr_.size() - 1; ++i)
+    {
+        Scalar gammaTildeC = 0.;
+
+        for(Label j = smoothingRowPtr_[i]; j < smoothingRowPtr_[i + 1]; ++j)
+            gammaTildeC += smoothingVals_[j] * gamma[smoothingColInd_[j]];
+
+        gammaTilde[i] = gammaTildeC;
+    }
+
+    gammaTilde.sendMessages();
+    gammaTilde.setBoundaryFaces();
+}
+
+void SurfaceTensionForce::smoothGammaField(const ScalarFiniteVolumeField &gamma, const CellSet &cells)
+{
+    auto &gammaTilde = *gammaTilde_;
+
+#pragma omp parallel for
+    for(Label i = 0; i < cells.size(); ++i)
+    {
+        Label id = cells[i].id();
+        Scalar gammaTildeC = 0.;
+
+        for(Label j = smoothingRowPtr_[id]; j < smoothingRowPtr_[id + 1]; ++j)
+            gammaTildeC += smoothingVals_[j] * gamma[smoothingColInd_[j]];
+
+        gammaTilde[id] = gammaTildeC;
+    }
 
     gammaTilde.sendMessages();
     gammaTilde.setBoundaryFaces();
@@ -112,6 +139,28 @@ SurfaceTensionForce::SmoothingKernel::Type SurfaceTensionForce::getKernelType(st
 
 }
 
+void SurfaceTensionForce::initSmoothingOperator(bool axisymmetric)
+{
+    smoothingRowPtr_.assign(1, 0);
+    smoothingColInd_.clear();
+    smoothingVals_.clear();
+
+    for(const Cell &cell: grid_->cells())
+    {
+        if(fluid_->isInSet(cell))
+        {
+            SmoothingKernel k(cell, kernelWidth_, kernelType_);
+
+            if(axisymmetric)
+                k.setAxisymmetric(true);
+
+            k.addWeights(smoothingColInd_, smoothingVals_);
+        }
+
+        smoothingRowPtr_.push_back(smoothingColInd_.size());
+    }
+}
+
 //Vector2D SurfaceTensionForce::computeCapillaryForce(const ScalarFiniteVolumeField &gamma,
 //                                                    const ImmersedBoundaryObject &ibObj) const
 //{
@@ -3,6 +3,7 @@
 
 #include "FiniteVolume/Field/VectorFiniteVolumeField.h"
 #include "FiniteVolume/Field/ScalarGradient.h"
+#include "FiniteVolumeGrid2D/Cell/CellSet.h"
 
 class SurfaceTensionForce
 {
@@ -23,6 +24,9 @@ public:
 
         Scalar eval(const ScalarFiniteVolumeField &phi) const;
 
+        //- Appends the ids of the kernel cells and their normalized weights
+        void addWeights(std::vector<Label> &ids, std::vector<Scalar> &weights) const;
+
     private:
 
         //        Scalar kernel(Scalar r) const
@@ -84,10 +88,20 @@ public:
 
     void smoothGammaField(const ScalarFiniteVolumeField &gamma);
 
+    //- Smooths gamma on the given cells only, gammaTilde is left unchanged elsewhere
+    void smoothGammaField(const ScalarFiniteVolumeField &gamma, const CellSet &cells);
+
 protected:
 
     static SmoothingKernel::Type getKernelType(std::string type);
 
+    //- Cells on which the interface normals are computed, they are zero elsewhere
+    virtual const CellSet &interfaceCells() const
+    { return *fluid_; }
+
+    //- Assembles the smoothing operator as a sparse matrix with one row per grid cell, rows of non-fluid cells are empty
+    void initSmoothingOperator(bool axisymmetric);
+
     std::shared_ptr<const FiniteVolumeGrid2D> grid_;
 
     std::shared_ptr<const CellGroup> fluid_;
@@ -98,7 +112,10 @@ protected:
 
     std::unordered_map<std::string, Scalar> patchContactAngles_;
 
-    std::vector<SmoothingKernel> kernels_;
+    //- Smoothing operator in CSR format, row i gives gammaTilde of cell i
+    std::vector<Label> smoothingRowPtr_, smoothingColInd_;
+
+    std::vector<Scalar> smoothingVals_;
 
     //- Fields, can share ownership
     std::shared_ptr<VectorFiniteVolumeField> fst_;
@@ -40,6 +40,16 @@ Scalar SurfaceTensionForce::SmoothingKernel::eval(const ScalarFiniteVolumeField
     return A_ * phiTilde;
 }
 
+void SurfaceTensionForce::SmoothingKernel::addWeights(std::vector<Label> &ids, std::vector<Scalar> &weights) const
+{
+    for(const Cell &kCell: kCells_)
+    {
+        ids.push_back(kCell.id());
+        weights.push_back(A_ * kernel(kCell.centroid() - cell_.centroid(), type_)
+                          * (axisymmetric_ ? kCell.polarVolume() : kCell.volume()));
+    }
+}
+
 Scalar SurfaceTensionForce::SmoothingKernel::kernel(Vector2D dx, Type type) const
 {
     switch (type)
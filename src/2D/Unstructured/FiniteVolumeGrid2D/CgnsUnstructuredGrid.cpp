@@ -1,3 +1,9 @@
+#include <set>
+
+#ifdef PHASE_PARMETIS
+#include <parmetis.h>
+#endif
+
 #include "System/CgnsFile.h"
 
 #include "CgnsUnstructuredGrid.h"
@@ -34,31 +40,41 @@ void CgnsUnstructuredGrid::load(const std::string &filename, const Point2D &orig
     if (zone.type != "Unstructured")
         throw Exception("CgnsUnstructuredGrid", "CgnsUnstructuredGrid", "zone type must be \"Unstructured\".");
 
-    int nSections = file.nSections(1, 1);
-    std::vector<std::vector<int>> adjncy;
+    //- Gather all elements, including the boundary patch elements, into flat arrays ordered by element id. Sections
+    //- are read one at a time in id order, elements in no section are left empty
+    std::vector<CgnsFile::Section> sections;
+    int nElems = 0;
 
-    //- Gather all elements, including the boundary patch elements
-    for (int sid = 1; sid <= nSections; ++sid)
+    for (int sid = 1; sid <= file.nSections(1, 1); ++sid)
     {
-        auto section = file.readSection(1, 1, sid);
-
-        if (adjncy.size() < section.end)
-            adjncy.resize(section.end);
-        for (auto id = section.start; id <= section.end; ++id)
-            adjncy[id - 1].assign(section.cind.begin() + section.cptr[id - section.start],
-                                  section.cind.begin() + section.cptr[id - section.start + 1]);
+        sections.push_back(file.readSectionInfo(1, 1, sid));
+        nElems = std::max(nElems, sections.back().end);
     }
 
-    std::vector<int> eptr(1, 0), eind;
+    std::sort(sections.begin(), sections.end(), [](const CgnsFile::Section &lhs, const CgnsFile::Section &rhs)
+    { return lhs.start < rhs.start; });
+
+    std::vector<int> eptr, eind;
+    eptr.reserve(nElems + 1);
+    eptr.push_back(0);
 
-    for (const auto &elem: adjncy)
+    for (const auto &info: sections)
     {
-        eptr.push_back(eptr.back() + elem.size());
-        eind.insert(eind.end(), elem.begin(), elem.end());
-    }
+        auto section = file.readSection(1, 1, info.id);
+
+        if (section.start < eptr.size())
+            throw Exception("CgnsUnstructuredGrid", "load", "section \"" + section.name + "\" overlaps another section.");
+
+        eptr.resize(section.start, eptr.back());
+
+        for (int i = 1; i < section.cptr.size(); ++i)
+            eptr.push_back(eind.size() + section.cptr[i]);
 
-    std::transform(eind.begin(), eind.end(), eind.begin(), [](int id)
-    { return id - 1; });
+        eind.reserve(eind.size() + section.cind.size());
+
+        for (int id: section.cind)
+            eind.push_back(id - 1);
+    }
 
     std::vector<Point2D> nodes = file.readCoords<Point2D>(1, 1);
     std::transform(nodes.begin(), nodes.end(), nodes.begin(), [origin](const Point2D &node)
@@ -101,15 +117,24 @@ void CgnsUnstructuredGrid::load(const std::string &filename, const Point2D &orig
     file.close();
 
     //- init all other elements
-    std::vector<Label> cptr(1, 0), cind;
+    std::vector<Label> cptr, cind;
+    cptr.reserve(eptr.size());
+    cind.reserve(eind.size());
+    cptr.push_back(0);
 
     for (auto id = 0; id < eptr.size() - 1; ++id)
         if (eptr[id + 1] - eptr[id] > 2)
         {
-            cptr.push_back(cptr.back() + eptr[id + 1] - eptr[id]);
-            cind.insert(cind.end(), eind.begin() + eptr[id], eind.begin() + eptr[id + 1]);
+            for (int j = eptr[id]; j < eptr[id + 1]; ++j)
+                cind.push_back(eind[j]);
+
+            cptr.push_back(cind.size());
         }
 
+    //- Release the element arrays before the grid entities are created
+    std::vector<int>().swap(eptr);
+    std::vector<int>().swap(eind);
+
     init(nodes, cptr, cind, Point2D(0., 0.));
     initPatches(patches);
 }
@@ -138,3 +163,290 @@ void CgnsUnstructuredGrid::readPartitionData(const std::string &filename)
 
     file.close();
 }
+
+void CgnsUnstructuredGrid::loadDistributed(const std::string &filename, const Point2D &origin)
+{
+#ifndef PHASE_PARMETIS
+    throw Exception("CgnsUnstructuredGrid", "loadDistributed", "Phase was built without ParMETIS support.");
+#else
+    using namespace std;
+
+    const int nProcs = comm_->nProcs();
+    const int rank = comm_->rank();
+
+    CgnsFile file(filename, CgnsFile::READ);
+
+    auto base = file.readBase(1);
+
+    comm_->printf("Read base \"%s\".\n", base.name.c_str());
+
+    if (base.cellDim != 2)
+        throw Exception("CgnsUnstructuredGrid", "loadDistributed", "cell dimension must be be 2.");
+
+    auto zone = file.readZone(1, 1);
+
+    if (zone.type != "Unstructured")
+        throw Exception("CgnsUnstructuredGrid", "loadDistributed", "zone type must be \"Unstructured\".");
+
+    //- Each proc reads a contiguous slab of the elements in the non-boundary sections
+    vector<CgnsFile::Section> sections;
+    int nElems = 0;
+
+    for (int sid = 1; sid <= file.nSections(1, 1); ++sid)
+    {
+        auto section = file.readSectionInfo(1, 1, sid);
+
+        if (section.type != "BAR_2")
+        {
+            sections.push_back(section);
+            nElems += section.end - section.start + 1;
+        }
+    }
+
+    int elemBegin = (long) nElems * rank / nProcs;
+    int elemEnd = (long) nElems * (rank + 1) / nProcs;
+    int offset = 0;
+
+    vector<idx_t> eptr(1, 0), eind;
+
+    for (const auto &info: sections)
+    {
+        int nSectionElems = info.end - info.start + 1;
+        int begin = max(elemBegin - offset, 0), end = min(elemEnd - offset, nSectionElems);
+        offset += nSectionElems;
+
+        if (begin >= end)
+            continue;
+
+        auto section = file.readSection(1, 1, info.id, info.start + begin, info.start + end - 1);
+
+        for (int i = 0; i < section.cptr.size() - 1; ++i)
+            if (section.cptr[i + 1] - section.cptr[i] > 2)
+            {
+                for (int j = section.cptr[i]; j < section.cptr[i + 1]; ++j)
+                    eind.push_back(section.cind[j] - 1);
+
+                eptr.push_back(eind.size());
+            }
+    }
+
+    //- Partition the dual graph of the distributed mesh
+    comm_->printf("Partitioning grid into %d partitions using ParMETIS...\n", nProcs);
+
+    vector<idx_t> elmdist(1, 0);
+
+    for (Size nCells: comm_->allGather(eptr.size() - 1))
+        elmdist.push_back(elmdist.back() + nCells);
+
+    idx_t wgtflag = 0, numflag = 0, ncon = 1, ncommonnodes = 2, nparts = nProcs, edgecut;
+    idx_t options[3] = {0, 0, 0};
+    vector<real_t> tpwgts(nparts, 1. / nparts);
+    real_t ubvec = 1.05;
+    vector<idx_t> cellPartition(eptr.size() - 1);
+    MPI_Comm comm = comm_->communicator();
+
+    int status = ParMETIS_V3_PartMeshKway(elmdist.data(), eptr.data(), eind.data(), NULL,
+                                          &wgtflag, &numflag, &ncon, &ncommonnodes, &nparts,
+                                          tpwgts.data(), &ubvec, options, &edgecut,
+                                          cellPartition.data(), &comm);
+
+    if (status != METIS_OK)
+        throw Exception("CgnsUnstructuredGrid", "loadDistributed", "an error occurred during partitioning.");
+
+    comm_->printf("Sucessfully computed partitioning.\n");
+
+    //- Cells are exchanged as records of (global id, number of nodes, node ids...)
+    auto packCell = [](vector<Label> &buffer, Label id, const vector<Label> &nodes)
+    {
+        buffer.push_back(id);
+        buffer.push_back(nodes.size());
+        buffer.insert(buffer.end(), nodes.begin(), nodes.end());
+    };
+
+    auto unpackCells = [](const vector<Label> &buffer, const function<void(Label, vector<Label>)> &fcn)
+    {
+        for (Label i = 0; i < buffer.size(); i += 2 + buffer[i + 1])
+            fcn(buffer[i], vector<Label>(buffer.begin() + i + 2, buffer.begin() + i + 2 + buffer[i + 1]));
+    };
+
+    //- Migrate cells to their owning procs
+    comm_->printf("Migrating cells...\n");
+    vector<vector<Label>> sendBuffers(nProcs);
+
+    for (Label i = 0; i < cellPartition.size(); ++i)
+        packCell(sendBuffers[cellPartition[i]], elmdist[rank] + i, vector<Label>(eind.begin() + eptr[i], eind.begin() + eptr[i + 1]));
+
+    map<Label, vector<Label>> ownedCells;
+
+    for (const auto &buffer: comm_->allToAllv(sendBuffers))
+        unpackCells(buffer, [&ownedCells](Label id, vector<Label> nodes) { ownedCells[id] = std::move(nodes); });
+
+    //- Buffer cells share a node with an owned cell. They are found by a rendezvous at the proc holding each node
+    //- in a slab decomposition of the nodes.
+    comm_->printf("Computing the local cell domains...\n");
+    Label nNodes = zone.size[0];
+    Label nodeBlock = (nNodes + nProcs - 1) / nProcs;
+    vector<vector<Label>> nodeCells(nProcs);
+
+    for (const auto &entry: ownedCells)
+        for (Label node: entry.second)
+            nodeCells[node / nodeBlock].insert(nodeCells[node / nodeBlock].end(), {node, entry.first});
+
+    unordered_map<Label, vector<pair<Label, int>>> cellsOfNode;
+    auto recvBuffers = comm_->allToAllv(nodeCells);
+
+    for (int proc = 0; proc < nProcs; ++proc)
+        for (Label i = 0; i < recvBuffers[proc].size(); i += 2)
+            cellsOfNode[recvBuffers[proc][i]].push_back(make_pair(recvBuffers[proc][i + 1], proc));
+
+    vector<vector<Label>> requests(nProcs);
+
+    for (const auto &entry: cellsOfNode)
+        for (const auto &lCell: entry.second)
+            for (const auto &rCell: entry.second)
+                if (lCell.second != rCell.second)
+                    requests[rCell.second].insert(requests[rCell.second].end(), {rCell.first, (Label) lCell.second});
+
+    recvBuffers = comm_->allToAllv(requests);
+    vector<set<Label>> bufferCellsToSend(nProcs);
+
+    for (int proc = 0; proc < nProcs; ++proc)
+        for (Label i = 0; i < recvBuffers[proc].size(); i += 2)
+            bufferCellsToSend[recvBuffers[proc][i + 1]].insert(recvBuffers[proc][i]);
+
+    for (int proc = 0; proc < nProcs; ++proc)
+    {
+        sendBuffers[proc].clear();
+
+        for (Label id: bufferCellsToSend[proc])
+            packCell(sendBuffers[proc], id, ownedCells[id]);
+    }
+
+    map<Label, pair<int, vector<Label>>> bufferCells;
+    recvBuffers = comm_->allToAllv(sendBuffers);
+
+    for (int proc = 0; proc < nProcs; ++proc)
+        unpackCells(recvBuffers[proc], [proc, &bufferCells](Label id, vector<Label> nodes)
+        { bufferCells[id] = make_pair(proc, std::move(nodes)); });
+
+    //- Fetch the coordinates of the local nodes from the procs holding them
+    set<Label> nodeIds;
+
+    for (const auto &entry: ownedCells)
+        nodeIds.insert(entry.second.begin(), entry.second.end());
+
+    for (const auto &entry: bufferCells)
+        nodeIds.insert(entry.second.second.begin(), entry.second.second.end());
+
+    vector<vector<Label>> nodeRequests(nProcs);
+
+    for (Label node: nodeIds)
+        nodeRequests[node / nodeBlock].push_back(node);
+
+    Label nodeBegin = rank * nodeBlock;
+    auto coords = file.readCoords<Point2D>(1, 1, nodeBegin + 1, min(nNodes, nodeBegin + nodeBlock));
+    vector<vector<Point2D>> coordReplies(nProcs);
+    recvBuffers = comm_->allToAllv(nodeRequests);
+
+    for (int proc = 0; proc < nProcs; ++proc)
+        for (Label node: recvBuffers[proc])
+            coordReplies[proc].push_back(coords[node - nodeBegin] + origin);
+
+    auto coordBuffers = comm_->allToAllv(coordReplies);
+    unordered_map<Label, Label> localNodeIds;
+    vector<Point2D> nodes;
+
+    for (int proc = 0; proc < nProcs; ++proc)
+        for (Label i = 0; i < nodeRequests[proc].size(); ++i)
+        {
+            localNodeIds[nodeRequests[proc][i]] = nodes.size();
+            nodes.push_back(coordBuffers[proc][i]);
+        }
+
+    //- Boundary patches, boundary elements are few enough to be read on every proc
+    comm_->printf("Computing the local boundary patches...\n");
+    unordered_map<string, vector<Label>> patches;
+
+    for (int bcid = 1; bcid <= file.nBoCos(1, 1); ++bcid)
+    {
+        auto boco = file.readBoCo(1, 1, bcid);
+        vector<int> elems;
+
+        if (boco.pointListType == "PointRange")
+        {
+            for (int id = boco.pnts[0]; id <= boco.pnts[1]; ++id)
+                elems.push_back(id);
+        }
+        else if (boco.pointListType == "PointList")
+            elems = boco.pnts;
+        else
+            throw Exception("CgnsUnstructuredGrid", "loadDistributed",
+                            "bad point set type \"" + boco.pointListType + "\"");
+
+        if (elems.empty())
+            continue;
+
+        auto bounds = minmax_element(elems.begin(), elems.end());
+        unordered_map<int, vector<Label>> elemNodes;
+
+        for (int sid = 1; sid <= file.nSections(1, 1); ++sid)
+        {
+            auto info = file.readSectionInfo(1, 1, sid);
+            int begin = max(info.start, *bounds.first), end = min(info.end, *bounds.second);
+
+            if (begin > end)
+                continue;
+
+            auto section = file.readSection(1, 1, sid, begin, end);
+
+            for (int i = 0; i < section.cptr.size() - 1; ++i)
+                for (int j = section.cptr[i]; j < section.cptr[i + 1]; ++j)
+                    elemNodes[begin + i].push_back(section.cind[j] - 1);
+        }
+
+        vector<Label> &pts = patches[boco.name];
+
+        for (int id: elems)
+        {
+            const vector<Label> &elem = elemNodes[id];
+
+            if (elem.size() == 2 && localNodeIds.count(elem[0]) && localNodeIds.count(elem[1]))
+                pts.insert(pts.end(), {localNodeIds[elem[0]], localNodeIds[elem[1]]});
+        }
+
+        comm_->printf("Read boundary patch \"%s\".\n", boco.name.c_str());
+    }
+
+    file.close();
+
+    //- The local grid is the owned cells followed by the buffer cells
+    comm_->printf("Initializing local domains...\n");
+    vector<Label> cptr(1, 0), cind, ownership, globalIds;
+
+    for (const auto &entry: ownedCells)
+    {
+        for (Label node: entry.second)
+            cind.push_back(localNodeIds[node]);
+
+        cptr.push_back(cind.size());
+        ownership.push_back(rank);
+        globalIds.push_back(entry.first);
+    }
+
+    for (const auto &entry: bufferCells)
+    {
+        for (Label node: entry.second.second)
+            cind.push_back(localNodeIds[node]);
+
+        cptr.push_back(cind.size());
+        ownership.push_back(entry.second.first);
+        globalIds.push_back(entry.first);
+    }
+
+    init(nodes, cptr, cind, Point2D(0., 0.));
+    initPatches(patches);
+
+    comm_->printf("Initiating inter-process communication buffers...\n");
+    initCommBuffers(ownership, globalIds);
+#endif
+}
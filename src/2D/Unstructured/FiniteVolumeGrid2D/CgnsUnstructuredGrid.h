@@ -13,6 +13,10 @@ public:
 
     void load(const std::string& filename, const Point2D &origin);
 
+    //- Reads a slab of the grid on each proc and partitions it with ParMETIS, the global grid is never assembled. Only a
+    //- single layer of node-sharing buffer cells is built, so Grid.minBufferWidth and Grid.cellOrdering are not supported
+    void loadDistributed(const std::string &filename, const Point2D &origin);
+
     void readPartitionData(const std::string& filename);
 
 private:
@@ -0,0 +1,85 @@
+#include <algorithm>
+
+#include "FaceDirectory.h"
+
+void FaceDirectory::reserve(Size nFaces)
+{
+    Size capacity = 16;
+
+    while (capacity < 2 * nFaces)
+        capacity *= 2;
+
+    if (capacity > entries_.size())
+        rehash(capacity);
+}
+
+void FaceDirectory::clear()
+{
+    entries_.clear();
+    size_ = 0;
+}
+
+std::pair<Label, bool> FaceDirectory::insert(Label n1, Label n2, Label id)
+{
+    if (2 * (size_ + 1) > entries_.size())
+        rehash(std::max(Size(16), 2 * entries_.size()));
+
+    if (n2 < n1)
+        std::swap(n1, n2);
+
+    for (Size i = slot(n1, n2);; i = (i + 1) & (entries_.size() - 1))
+    {
+        Entry &entry = entries_[i];
+
+        if (entry.id == npos)
+        {
+            entry = Entry{n1, n2, id};
+            ++size_;
+            return std::make_pair(id, true);
+        }
+        else if (entry.n1 == n1 && entry.n2 == n2)
+            return std::make_pair(entry.id, false);
+    }
+}
+
+Label FaceDirectory::find(Label n1, Label n2) const
+{
+    if (entries_.empty())
+        return npos;
+
+    if (n2 < n1)
+        std::swap(n1, n2);
+
+    for (Size i = slot(n1, n2);; i = (i + 1) & (entries_.size() - 1))
+    {
+        const Entry &entry = entries_[i];
+
+        if (entry.id == npos || (entry.n1 == n1 && entry.n2 == n2))
+            return entry.id;
+    }
+}
+
+//- Private methods
+
+Size FaceDirectory::slot(Label n1, Label n2) const
+{
+    unsigned long long h = n1 * 0x9E3779B97F4A7C15ull ^ n2 * 0xC2B2AE3D27D4EB4Full;
+    h ^= h >> 29;
+
+    return h & (entries_.size() - 1);
+}
+
+void FaceDirectory::rehash(Size capacity)
+{
+    std::vector<Entry> entries(capacity, Entry{0, 0, npos});
+    std::swap(entries, entries_);
+
+    for (const Entry &entry: entries)
+        if (entry.id != npos)
+            for (Size i = slot(entry.n1, entry.n2);; i = (i + 1) & (entries_.size() - 1))
+                if (entries_[i].id == npos)
+                {
+                    entries_[i] = entry;
+                    break;
+                }
+}
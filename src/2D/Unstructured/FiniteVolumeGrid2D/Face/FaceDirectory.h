@@ -0,0 +1,48 @@
+#ifndef PHASE_FACE_DIRECTORY_H
+#define PHASE_FACE_DIRECTORY_H
+
+#include <vector>
+#include <limits>
+
+#include "Types/Types.h"
+
+//- Finds a face given its two node ids, in either order. An open addressing hash table with linear probing, which
+//- avoids the per-entry allocations and pointer chasing of a tree when the faces of a large grid are created
+class FaceDirectory
+{
+public:
+
+    static const Label npos = std::numeric_limits<Label>::max();
+
+    //- Sizes the table for nFaces without any rehashing
+    void reserve(Size nFaces);
+
+    void clear();
+
+    Size size() const
+    { return size_; }
+
+    //- Adds the face if no face exists between n1 and n2. Returns the id of the face between them and true if added
+    std::pair<Label, bool> insert(Label n1, Label n2, Label id);
+
+    //- Id of the face between n1 and n2, or npos
+    Label find(Label n1, Label n2) const;
+
+private:
+
+    struct Entry
+    {
+        Label n1, n2, id;
+    };
+
+    Size slot(Label n1, Label n2) const;
+
+    void rehash(Size capacity);
+
+    //- The capacity is a power of two kept at least twice the size
+    std::vector<Entry> entries_;
+
+    Size size_ = 0;
+};
+
+#endif
@@ -1,4 +1,5 @@
 #include <numeric>
+#include <algorithm>
 
 #include <metis.h>
 
@@ -10,6 +11,10 @@ FiniteVolumeGrid2D::FiniteVolumeGrid2D()
       boundaryFaces_("BoundaryFaces"),
       localCells_("LocalCells"),
       globalCells_("GlobalCells"),
+      interiorCells_("InteriorCells"),
+      nearHaloCells_("NearHaloCells"),
+      innerFaces_("InnerFaces"),
+      nearHaloFaces_("NearHaloFaces"),
       comm_(std::make_shared<Communicator>())
 {
 
@@ -32,12 +37,24 @@ void FiniteVolumeGrid2D::init(const std::vector<Point2D> &nodes,
 {
     reset();
 
+    //- By Euler's formula a 2D grid has about as many faces as nodes and cells together
+    Size nFaces = nodes.size() + cptr.size() - 1;
+
+    nodes_.reserve(nodes.size());
+    faces_.reserve(nFaces);
+    faceDirectory_.reserve(nFaces);
+
     for (const Point2D &node: nodes)
         nodes_.push_back(Node(node + origin, *this));
 
     cells_.reserve(cptr.size() - 1); // very important, can break without reserve
+    std::vector<Label> nodeIds;
+
     for (int i = 0; i < cptr.size() - 1; ++i)
-        createCell(std::vector<Label>(cind.begin() + cptr[i], cind.begin() + cptr[i + 1]));
+    {
+        nodeIds.assign(cind.begin() + cptr[i], cind.begin() + cptr[i + 1]);
+        createCell(nodeIds);
+    }
 
     init();
 }
@@ -58,6 +75,9 @@ void FiniteVolumeGrid2D::reset()
     //- Communication zones
     sendCellGroups_.clear(); // shared pointers are used so that zones can be moveable!
     bufferCellGroups_.clear();
+    haloExchange_.reset();
+    interiorCells_.clear();
+    nearHaloCells_.clear();
 
     //- Face related data
     faces_.clear();
@@ -66,6 +86,8 @@ void FiniteVolumeGrid2D::reset()
     //- Interior and boundary face data structures
     interiorFaces_.clear();
     boundaryFaces_.clear();
+    innerFaces_.clear();
+    nearHaloFaces_.clear();
 
     //- User defined face groups and patches
     patches_.clear();
@@ -101,19 +123,17 @@ Label FiniteVolumeGrid2D::createCell(const std::vector<Label> &nodeIds)
     {
         Label n1 = nodeIds[i], n2 = nodeIds[(i + 1) % end];
 
-        auto key = n1 < n2 ? make_pair(n1, n2) : make_pair(n2, n1);
-        auto it = faceDirectory_.find(key);
+        auto insert = faceDirectory_.insert(n1, n2, faces_.size());
 
-        if (it == faceDirectory_.end()) // face doesn't exist, so create it
+        if (insert.second) // face doesn't exist, so create it
         {
             faces_.push_back(Face(n1, n2, *this, Face::BOUNDARY));
             Face &face = faces_.back();
-            faceDirectory_[key] = face.id();
             face.addCell(newCell);
         }
         else // face already exists, but is now an interior face
         {
-            Face &face = faces_[it->second];
+            Face &face = faces_[insert.first];
             face.setType(Face::INTERIOR);
             face.addCell(newCell);
         }
@@ -153,22 +173,20 @@ CellGroup FiniteVolumeGrid2D::globalCellGroup(const CellGroup &localGroup) const
 
 bool FiniteVolumeGrid2D::faceExists(Label n1, Label n2) const
 {
-    using namespace std;
-
-    return faceDirectory_.find(n1 < n2 ? make_pair(n1, n2) : make_pair(n2, n1)) != faceDirectory_.end();
+    return faceDirectory_.find(n1, n2) != FaceDirectory::npos;
 }
 
 Label FiniteVolumeGrid2D::findFace(Label n1, Label n2) const
 {
     using namespace std;
 
-    auto it = faceDirectory_.find(n1 < n2 ? make_pair(n1, n2) : make_pair(n2, n1));
+    Label fid = faceDirectory_.find(n1, n2);
 
-    if (it == faceDirectory_.end())
+    if (fid == FaceDirectory::npos)
         throw Exception("FiniteVolumeGrid2D", "findFace",
                         "no face found between n1 = " + to_string(n1) + ", n2 = " + to_string(n2) + ".");
 
-    return it->second;
+    return fid;
 }
 
 //- Patch related methods
@@ -293,14 +311,17 @@ void FiniteVolumeGrid2D::partition(const Input &input)
 {
     using namespace std;
 
-    if (comm_->nProcs() == 1) // no need to perform a partition
+    string ordering = input.caseInput().get<string>("Grid.cellOrdering", "none");
+
+    if (comm_->nProcs() == 1 && ordering == "none") // no need to perform a partition
         return;
 
-    comm_->printf("Partitioning grid into %d partitions...\n", comm_->nProcs());
-    vector<idx_t> cellPartition(nCells());
+    vector<idx_t> cellPartition(nCells(), 0);
 
-    if (comm_->isMainProc()) // partition is performed on main proc
+    if (comm_->nProcs() > 1 && comm_->isMainProc()) // partition is performed on main proc
     {
+        comm_->printf("Partitioning grid into %d partitions...\n", comm_->nProcs());
+
         idx_t nPartitions = comm_->nProcs();
         idx_t nElems = nCells();
         idx_t nNodes = this->nNodes();
@@ -349,26 +370,40 @@ void FiniteVolumeGrid2D::partition(const Input &input)
     vector<int> localNodeId(nodes_.size(), -1);
     Scalar r = input.caseInput().get<Scalar>("Grid.minBufferWidth", 0.);
 
+    vector<Label> cellIds;
+
     for (const Cell &cell: cells_)
         if (addCellToThisProc(cell, r))
-        {
-            cellInds.push_back(cellInds.back() + cell.nodes().size());
-            cellProc.push_back(cellPartition[cell.id()]);
+            cellIds.push_back(cell.id());
+
+    //- Cells are renumbered for locality, faces and nodes are numbered in order of first use by the cells
+    if (ordering != "none")
+    {
+        comm_->printf("Reordering local cells using \"%s\" ordering...\n", ordering.c_str());
+        cellIds = reorderCells(cellIds, ordering);
+    }
 
-            cellGlobalToLocalIdMap[cell.id()] = cellInds.size() - 2;
-            cellLocalToGlobalIdMap[cellInds.size() - 2] = cell.id();
+    for (Label id: cellIds)
+    {
+        const Cell &cell = cells_[id];
 
-            for (const Node &node: cell.nodes())
-            {
-                if (localNodeId[node.id()] == -1)
-                {
-                    localNodeId[node.id()] = nodes.size();
-                    nodes.push_back(node);
-                }
+        cellInds.push_back(cellInds.back() + cell.nodes().size());
+        cellProc.push_back(cellPartition[cell.id()]);
+
+        cellGlobalToLocalIdMap[cell.id()] = cellInds.size() - 2;
+        cellLocalToGlobalIdMap[cellInds.size() - 2] = cell.id();
 
-                cellNodeIds.push_back(localNodeId[node.id()]);
+        for (const Node &node: cell.nodes())
+        {
+            if (localNodeId[node.id()] == -1)
+            {
+                localNodeId[node.id()] = nodes.size();
+                nodes.push_back(node);
             }
+
+            cellNodeIds.push_back(localNodeId[node.id()]);
         }
+    }
 
     //- Boundary patches
     comm_->printf("Computing the local boundary patches...\n");
@@ -462,6 +497,8 @@ void FiniteVolumeGrid2D::init()
     //        for (const Face &face: entry.second)
     //            patchRegistry_[face.id()] = std::cref(entry.second);
 
+    initConnectivity();
+
     //- Init the local and global cell groups
     localCells_.clear();
     localCells_.add(cells_.begin(), cells_.end());
@@ -473,9 +510,167 @@ void FiniteVolumeGrid2D::init()
     globalIds_.resize(globalCells_.size());
     std::iota(globalIds_.begin(), globalIds_.end(), 0);
 
+    initHaloGroups();
+
     bBox_ = BoundingBox(nodes_.begin(), nodes_.end());
 }
 
+void FiniteVolumeGrid2D::initConnectivity()
+{
+    cellCentroids_.resize(cells_.size());
+    cellVolumes_.resize(cells_.size());
+    cellLinkPtr_.assign(1, 0);
+    cellLinkPtr_.reserve(cells_.size() + 1);
+
+    for (const Cell &cell: cells_)
+    {
+        cellCentroids_[cell.id()] = cell.centroid();
+        cellVolumes_[cell.id()] = cell.volume();
+        cellLinkPtr_.push_back(cellLinkPtr_.back() + cell.neighbours().size());
+    }
+
+    linkCells_.resize(cellLinkPtr_.back());
+    linkFaces_.resize(cellLinkPtr_.back());
+    linkNorms_.resize(cellLinkPtr_.back());
+    linkCellVecs_.resize(cellLinkPtr_.back());
+    linkFaceVecs_.resize(cellLinkPtr_.back());
+    linkWeights_.resize(cellLinkPtr_.back());
+
+    for (const Cell &cell: cells_)
+    {
+        Label j = cellLinkPtr_[cell.id()];
+
+        for (const InteriorLink &nb: cell.neighbours())
+        {
+            linkCells_[j] = nb.cell().id();
+            linkFaces_[j] = nb.face().id();
+            linkNorms_[j] = nb.outwardNorm();
+            linkCellVecs_[j] = nb.rCellVec();
+            linkFaceVecs_[j] = nb.rFaceVec();
+            linkWeights_[j++] = nb.distanceWeight();
+        }
+    }
+
+    faceOwners_.resize(faces_.size());
+    faceNeighbours_.resize(faces_.size());
+
+    for (const Face &face: faces_)
+    {
+        faceOwners_[face.id()] = face.lCell().id();
+        faceNeighbours_[face.id()] = face.isBoundary() ? -1 : face.rCell().id();
+    }
+}
+
+std::vector<Label> FiniteVolumeGrid2D::reorderCells(const std::vector<Label> &cellIds, const std::string &method) const
+{
+    using namespace std;
+
+    vector<Label> order;
+    order.reserve(cellIds.size());
+
+    if (method == "rcm")
+    {
+        //- Reverse Cuthill-McKee on the face adjacency of the selected cells
+        vector<Index> pos(cells_.size(), -1);
+
+        for (Label i = 0; i < cellIds.size(); ++i)
+            pos[cellIds[i]] = i;
+
+        auto degree = [this, &pos](Label id)
+        {
+            return count_if(cells_[id].neighbours().begin(), cells_[id].neighbours().end(),
+                            [&pos](const InteriorLink &nb) { return pos[nb.cell().id()] != -1; });
+        };
+
+        vector<bool> visited(cellIds.size(), false);
+        vector<Label> seeds(cellIds);
+
+        stable_sort(seeds.begin(), seeds.end(), [&degree](Label lhs, Label rhs)
+        { return degree(lhs) < degree(rhs); });
+
+        for (Label seed: seeds)
+        {
+            if (visited[pos[seed]])
+                continue;
+
+            visited[pos[seed]] = true;
+            order.push_back(seed);
+
+            for (Label front = order.size() - 1; front < order.size(); ++front)
+            {
+                vector<Label> nbs;
+
+                for (const InteriorLink &nb: cells_[order[front]].neighbours())
+                {
+                    Index j = pos[nb.cell().id()];
+
+                    if (j != -1 && !visited[j])
+                    {
+                        visited[j] = true;
+                        nbs.push_back(nb.cell().id());
+                    }
+                }
+
+                stable_sort(nbs.begin(), nbs.end(), [&degree](Label lhs, Label rhs)
+                { return degree(lhs) < degree(rhs); });
+
+                order.insert(order.end(), nbs.begin(), nbs.end());
+            }
+        }
+
+        reverse(order.begin(), order.end());
+    }
+    else if (method == "hilbert")
+    {
+        //- Sort by the index of the cell centroids along a Hilbert curve spanning the bounding box
+        const uint32_t n = 1u << 16;
+        Point2D x0 = bBox_.lBound();
+        Vector2D dx = bBox_.uBound() - bBox_.lBound();
+
+        auto hilbertIndex = [n, &x0, &dx](const Point2D &pt)
+        {
+            uint32_t x = min<uint32_t>(n - 1, (n - 1) * (pt.x - x0.x) / max(dx.x, 1e-14));
+            uint32_t y = min<uint32_t>(n - 1, (n - 1) * (pt.y - x0.y) / max(dx.y, 1e-14));
+            uint64_t d = 0;
+
+            for (uint32_t s = n / 2; s > 0; s /= 2)
+            {
+                uint32_t rx = (x & s) > 0, ry = (y & s) > 0;
+                d += uint64_t(s) * s * ((3 * rx) ^ ry);
+
+                if (ry == 0)
+                {
+                    if (rx == 1)
+                    {
+                        x = n - 1 - x;
+                        y = n - 1 - y;
+                    }
+
+                    swap(x, y);
+                }
+            }
+
+            return d;
+        };
+
+        vector<pair<uint64_t, Label>> keys;
+        keys.reserve(cellIds.size());
+
+        for (Label id: cellIds)
+            keys.push_back(make_pair(hilbertIndex(cells_[id].centroid()), id));
+
+        stable_sort(keys.begin(), keys.end(), [](const pair<uint64_t, Label> &lhs, const pair<uint64_t, Label> &rhs)
+        { return lhs.first < rhs.first; });
+
+        for (const auto &key: keys)
+            order.push_back(key.second);
+    }
+    else
+        throw Exception("FiniteVolumeGrid2D", "reorderCells", "unrecognized cell ordering \"" + method + "\".");
+
+    return order;
+}
+
 void FiniteVolumeGrid2D::initPatches(const std::unordered_map<std::string, std::vector<Label>> &patches)
 {
     patches_.clear();
@@ -538,4 +733,40 @@ void FiniteVolumeGrid2D::initCommBuffers(const std::vector<Label> &ownership, co
     }
 
     comm_->waitAll();
+
+    haloExchange_.reset(new HaloExchange(comm_, sendCellGroups_, bufferCellGroups_));
+
+    initHaloGroups();
+}
+
+void FiniteVolumeGrid2D::initHaloGroups()
+{
+    nearHalo_.assign(cells_.size(), false);
+
+    for (const CellGroup &group: sendCellGroups_)
+        for (const Cell &cell: group)
+            nearHalo_[cell.id()] = true;
+
+    for (const Cell &cell: localCells_)
+        for (const CellLink &nb: cell.cellLinks())
+            if (cellOwnership_[nb.cell().id()] != comm_->rank())
+                nearHalo_[cell.id()] = true;
+
+    interiorCells_.clear();
+    nearHaloCells_.clear();
+
+    for (const Cell &cell: localCells_)
+        if (nearHalo_[cell.id()])
+            nearHaloCells_.add(cell);
+        else
+            interiorCells_.add(cell);
+
+    innerFaces_.clear();
+    nearHaloFaces_.clear();
+
+    for (const Face &face: interiorFaces_)
+        if (cellOwnership_[face.lCell().id()] == comm_->rank() && cellOwnership_[face.rCell().id()] == comm_->rank())
+            innerFaces_.add(face);
+        else
+            nearHaloFaces_.add(face);
 }
@@ -12,6 +12,8 @@
 #include "Cell/CellGroup.h"
 #include "Face/Face.h"
 #include "Face/FaceGroup.h"
+#include "Face/FaceDirectory.h"
+#include "HaloExchange.h"
 
 #include "Geometry/BoundingBox.h"
 
@@ -87,6 +89,16 @@ public:
     const std::vector<CellGroup> &bufferGroups() const
     { return bufferCellGroups_; }
 
+    //- Local cells that neither are sent to nor neighbour another proc, these can be processed during a halo exchange
+    const CellGroup &interiorCells() const
+    { return interiorCells_; }
+
+    const CellGroup &nearHaloCells() const
+    { return nearHaloCells_; }
+
+    bool isNearHalo(const Cell &cell) const
+    { return nearHalo_[cell.id()]; }
+
     //- Face related methods
     std::vector<Face> &faces()
     { return faces_; }
@@ -100,10 +112,51 @@ public:
     const FaceGroup &boundaryFaces() const
     { return boundaryFaces_; }
 
+    //- Interior faces between two local cells, and those touching a buffer cell
+    const FaceGroup &innerFaces() const
+    { return innerFaces_; }
+
+    const FaceGroup &nearHaloFaces() const
+    { return nearHaloFaces_; }
+
     bool faceExists(Label n1, Label n2) const;
 
     Label findFace(Label n1, Label n2) const;
 
+    //- Flat connectivity, interior links are stored per cell in the same order as Cell::neighbours()
+    const std::vector<Point2D> &cellCentroids() const
+    { return cellCentroids_; }
+
+    const std::vector<Scalar> &cellVolumes() const
+    { return cellVolumes_; }
+
+    const std::vector<Index> &faceOwners() const
+    { return faceOwners_; }
+
+    const std::vector<Index> &faceNeighbours() const
+    { return faceNeighbours_; }
+
+    const std::vector<Label> &cellLinkPtr() const
+    { return cellLinkPtr_; }
+
+    const std::vector<Label> &linkCells() const
+    { return linkCells_; }
+
+    const std::vector<Label> &linkFaces() const
+    { return linkFaces_; }
+
+    const std::vector<Vector2D> &linkNorms() const
+    { return linkNorms_; }
+
+    const std::vector<Vector2D> &linkCellVecs() const
+    { return linkCellVecs_; }
+
+    const std::vector<Vector2D> &linkFaceVecs() const
+    { return linkFaceVecs_; }
+
+    const std::vector<Scalar> &linkWeights() const
+    { return linkWeights_; }
+
     //- Patch related methods
     FaceGroup &createPatch(const std::string &name, const std::vector<Label> &faces);
 
@@ -145,6 +198,20 @@ public:
     template<class T>
     void sendMessages(std::vector<T> &data, Size nSets) const;
 
+    //- Batches several arrays into a single message per neighbour
+    template<class T>
+    void sendMessages(std::initializer_list<std::vector<T>*> data) const;
+
+    //- Non-blocking halo exchange, data must not be modified until the exchange is ended
+    template<class T>
+    void beginSendMessages(std::vector<T> &data) const;
+
+    template<class T>
+    void endSendMessages(std::vector<T> &data) const;
+
+    const HaloExchange &haloExchange() const
+    { return *haloExchange_; }
+
     //- Misc
     const BoundingBox &boundingBox() const
     { return bBox_; }
@@ -157,6 +224,13 @@ protected:
 
     void initCommBuffers(const std::vector<Label> &ownership, const std::vector<Label> &globalIds);
 
+    void initConnectivity();
+
+    void initHaloGroups();
+
+    //- Returns the given cell ids in a locality preserving order, either "rcm" or "hilbert"
+    std::vector<Label> reorderCells(const std::vector<Label> &cellIds, const std::string &method) const;
+
     //- Node related data
     std::vector<Node> nodes_;
 
@@ -177,18 +251,39 @@ protected:
 
     std::vector<CellGroup> sendCellGroups_, bufferCellGroups_;
 
+    CellGroup interiorCells_, nearHaloCells_;
+
+    std::vector<bool> nearHalo_;
+
+    std::unique_ptr<HaloExchange> haloExchange_;
+
     //- Face related data
     std::vector<Face> faces_;
 
-    std::map<std::pair<Label, Label>, Label> faceDirectory_; // A directory that can find a face given the two node ids
+    FaceDirectory faceDirectory_; // A directory that can find a face given the two node ids
 
     //- Interior and boundary face data structures
     FaceGroup interiorFaces_, boundaryFaces_;
 
+    FaceGroup innerFaces_, nearHaloFaces_;
+
     std::unordered_map<std::string, FaceGroup> patches_;
 
     std::unordered_map<Label, Ref<const FaceGroup>> patchRegistry_;
 
+    //- Flat connectivity data
+    std::vector<Point2D> cellCentroids_;
+
+    std::vector<Scalar> cellVolumes_;
+
+    std::vector<Index> faceOwners_, faceNeighbours_;
+
+    std::vector<Label> cellLinkPtr_, linkCells_, linkFaces_;
+
+    std::vector<Vector2D> linkNorms_, linkCellVecs_, linkFaceVecs_;
+
+    std::vector<Scalar> linkWeights_;
+
     BoundingBox bBox_;
 };
 
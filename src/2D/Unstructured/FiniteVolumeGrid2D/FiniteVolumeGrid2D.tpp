@@ -3,96 +3,49 @@
 template<class T>
 void FiniteVolumeGrid2D::sendMessages(std::vector<T> &data) const
 {
-    if(!comm_ || comm_->nProcs() == 1)
+    if(!haloExchange_)
         return;
 
-    std::vector<std::vector<T>> recvBuffers(comm_->nProcs());
-
-    //- Post recvs first (non-blocking)
-    for(int proc = 0; proc < comm_->nProcs(); ++proc)
-    {
-        if(bufferCellGroups_[proc].empty())
-            continue;
-
-        recvBuffers[proc].resize(bufferCellGroups_[proc].size());
-        comm_->irecv(proc, recvBuffers[proc], proc);
-    }
-
-    //- Send data (blocking sends)
-    std::vector<T> sendBuffer;
-    for(int proc = 0; proc < comm_->nProcs(); ++proc)
-    {
-        if(sendCellGroups_[proc].empty())
-            continue;
-
-        sendBuffer.resize(sendCellGroups_[proc].size());
-
-        std::transform(sendCellGroups_[proc].begin(),
-                       sendCellGroups_[proc].end(),
-                       sendBuffer.begin(),
-                       [&data](const Cell& cell) { return data[cell.id()]; });
-
-        comm_->ssend(proc, sendBuffer, comm_->rank());
-    }
-    comm_->waitAll();
-
-    //- Unload recv buffers
-    for(int proc = 0; proc < comm_->nProcs(); ++proc)
-    {
-        if(recvBuffers[proc].empty())
-            continue;
-
-        int i = 0;
-        for(const Cell& cell: bufferCellGroups_[proc])
-            data[cell.id()] = recvBuffers[proc][i++];
-    }
+    haloExchange_->exchange(std::vector<T*>(1, data.data()), nCells());
 }
 
 template<class T>
 void FiniteVolumeGrid2D::sendMessages(std::vector<T> &data, Size nSets) const
 {
-    if(!comm_ || comm_->nProcs() == 1)
+    if(!haloExchange_)
         return;
 
-    std::vector<std::vector<T>> recvBuffers(comm_->nProcs());
+    haloExchange_->exchange(std::vector<T*>(1, data.data()), nCells(), nSets);
+}
 
-    //- Post recvs first (non-blocking)
-    for(int proc = 0; proc < comm_->nProcs(); ++proc)
-    {
-        if(bufferCellGroups_[proc].empty())
-            continue;
+template<class T>
+void FiniteVolumeGrid2D::sendMessages(std::initializer_list<std::vector<T>*> data) const
+{
+    if(!haloExchange_)
+        return;
 
-        recvBuffers[proc].resize(bufferCellGroups_[proc].size() * nSets);
-        comm_->irecv(proc, recvBuffers[proc], proc);
-    }
+    std::vector<T*> ptrs;
 
-    //- Send data (blocking sends)
-    std::vector<T> sendBuffer;
-    for(int proc = 0; proc < comm_->nProcs(); ++proc)
-    {
-        if(sendCellGroups_[proc].empty())
-            continue;
+    for(std::vector<T> *vals: data)
+        ptrs.push_back(vals->data());
 
-        sendBuffer.resize(sendCellGroups_[proc].size() * nSets);
+    haloExchange_->exchange(ptrs, nCells());
+}
 
-        Size i = 0;
-        for(Size set = 0; set < nSets; ++set)
-            for(const Cell& cell: sendCellGroups_[proc])
-                sendBuffer[i++] = data[cell.id() + set * nCells()];
+template<class T>
+void FiniteVolumeGrid2D::beginSendMessages(std::vector<T> &data) const
+{
+    if(!haloExchange_)
+        return;
 
-        comm_->ssend(proc, sendBuffer, comm_->rank());
-    }
-    comm_->waitAll();
+    haloExchange_->begin(std::vector<T*>(1, data.data()), nCells());
+}
 
-    //- Unload recv buffers
-    for(int proc = 0; proc < comm_->nProcs(); ++proc)
-    {
-        if(recvBuffers[proc].empty())
-            continue;
+template<class T>
+void FiniteVolumeGrid2D::endSendMessages(std::vector<T> &data) const
+{
+    if(!haloExchange_)
+        return;
 
-        int i = 0;
-        for(Size set = 0; set < nSets; ++set)
-            for(const Cell& cell: bufferCellGroups_[proc])
-                data[cell.id() + set * nCells()] = recvBuffers[proc][i++];
-    }
+    haloExchange_->end(std::vector<T*>(1, data.data()), nCells());
 }
@@ -12,7 +12,28 @@ std::shared_ptr<FiniteVolumeGrid2D> FiniteVolumeGrid2DFactory::create(GridType t
             grid = std::make_shared<StructuredRectilinearGrid>(input);
             break;
         case CGNS:
-            grid = std::make_shared<CgnsUnstructuredGrid>(input);
+            grid = std::make_shared<CgnsUnstructuredGrid>();
+
+            //- The distributed path partitions while loading, so the global grid is never assembled on one proc
+            if (input.caseInput().get<std::string>("Grid.partitioner", "metis") == "parmetis"
+                && grid->comm().nProcs() > 1)
+            {
+                //- Only a single layer of node-sharing buffer cells is built, and the cells are not renumbered
+                if (input.caseInput().get<Scalar>("Grid.minBufferWidth", 0.) > 0.
+                    || input.caseInput().get<std::string>("Grid.cellOrdering", "none") != "none")
+                    throw Exception("FiniteVolumeGrid2DFactory", "create",
+                                    "Grid.minBufferWidth and Grid.cellOrdering are not supported by the parmetis "
+                                    "partitioner, use the metis partitioner instead.");
+
+                std::static_pointer_cast<CgnsUnstructuredGrid>(grid)->loadDistributed(
+                        input.caseInput().get<std::string>("Grid.filename"),
+                        input.caseInput().get<std::string>("Grid.origin", "(0,0)"));
+                return grid;
+            }
+
+            std::static_pointer_cast<CgnsUnstructuredGrid>(grid)->load(
+                    input.caseInput().get<std::string>("Grid.filename"),
+                    input.caseInput().get<std::string>("Grid.origin", "(0,0)"));
             break;
         case LOAD:
             auto grid = std::make_shared<CgnsUnstructuredGrid>();
@@ -0,0 +1,100 @@
+#include "HaloExchange.h"
+
+HaloExchange::HaloExchange(const std::shared_ptr<const Communicator> &comm,
+                           const std::vector<CellGroup> &sendGroups,
+                           const std::vector<CellGroup> &bufferGroups)
+    :
+      comm_(comm),
+      sendPtr_(1, 0),
+      recvPtr_(1, 0)
+{
+    MPI_Comm_dup(comm_->communicator(), &haloComm_);
+
+    //- Send and buffer groups are paired across procs, so the neighbour relationship is symmetric
+    for (int proc = 0; proc < comm_->nProcs(); ++proc)
+    {
+        if (proc == comm_->rank() || (sendGroups[proc].empty() && bufferGroups[proc].empty()))
+            continue;
+
+        neighbours_.push_back(proc);
+
+        for (const Cell &cell: sendGroups[proc])
+            sendIds_.push_back(cell.id());
+
+        for (const Cell &cell: bufferGroups[proc])
+            recvIds_.push_back(cell.id());
+
+        sendPtr_.push_back(sendIds_.size());
+        recvPtr_.push_back(recvIds_.size());
+    }
+}
+
+HaloExchange::~HaloExchange()
+{
+    int finalized;
+    MPI_Finalized(&finalized);
+
+    if (finalized)
+        return;
+
+    for (auto &entry: channels_)
+        for (MPI_Request &request: entry.second.requests)
+            MPI_Request_free(&request);
+
+    MPI_Comm_free(&haloComm_);
+}
+
+HaloExchange::Channel &HaloExchange::channel(Size nBytes) const
+{
+    auto it = channels_.find(nBytes);
+
+    if (it != channels_.end())
+        return it->second;
+
+    Channel &ch = channels_[nBytes];
+
+    ch.sendBuffer.resize(nBytes * sendIds_.size());
+    ch.recvBuffer.resize(nBytes * recvIds_.size());
+    ch.requests.resize(2 * neighbours_.size());
+
+    //- The message size doubles as the tag, so that exchanges of different sizes can overlap. Only halo exchanges
+    //- use haloComm_, so no other message can match these tags
+    int tag = nBytes;
+
+    for (Label i = 0; i < neighbours_.size(); ++i)
+    {
+        MPI_Recv_init(ch.recvBuffer.data() + nBytes * recvPtr_[i],
+                      nBytes * (recvPtr_[i + 1] - recvPtr_[i]),
+                      MPI_BYTE,
+                      neighbours_[i],
+                      tag,
+                      haloComm_,
+                      &ch.requests[i]);
+
+        MPI_Send_init(ch.sendBuffer.data() + nBytes * sendPtr_[i],
+                      nBytes * (sendPtr_[i + 1] - sendPtr_[i]),
+                      MPI_BYTE,
+                      neighbours_[i],
+                      tag,
+                      haloComm_,
+                      &ch.requests[neighbours_.size() + i]);
+    }
+
+    return ch;
+}
+
+void HaloExchange::start(Channel &channel) const
+{
+    if (!channel.requests.empty())
+        MPI_Startall(channel.requests.size(), channel.requests.data());
+
+    channel.active = true;
+}
+
+void HaloExchange::wait(Channel &channel) const
+{
+    if (!channel.requests.empty())
+        MPI_Waitall(channel.requests.size(), channel.requests.data(), MPI_STATUSES_IGNORE);
+
+    channel.active = false;
+}
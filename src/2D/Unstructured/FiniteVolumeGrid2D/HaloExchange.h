@@ -0,0 +1,79 @@
+#ifndef PHASE_HALO_EXCHANGE_H
+#define PHASE_HALO_EXCHANGE_H
+
+#include <map>
+#include <memory>
+
+#include "System/Communicator.h"
+
+#include "Cell/CellGroup.h"
+
+//- Exchanges buffer cell data with the neighbouring procs only. Persistent requests on preallocated buffers are
+//- created once per message size, so repeated exchanges only pack, start, wait and unpack.
+class HaloExchange
+{
+public:
+
+    HaloExchange(const std::shared_ptr<const Communicator> &comm,
+                 const std::vector<CellGroup> &sendGroups,
+                 const std::vector<CellGroup> &bufferGroups);
+
+    //- Make non-copyable, the persistent requests point into the buffers
+    HaloExchange(const HaloExchange &other) = delete;
+
+    HaloExchange &operator=(const HaloExchange &other) = delete;
+
+    ~HaloExchange();
+
+    const std::vector<int> &neighbours() const
+    { return neighbours_; }
+
+    //- Exchange nSets blocks of nCells values of each array in data, all arrays are batched into one message per
+    //- neighbour. Only one exchange of a given message size may be in progress at a time.
+    template<class T>
+    void begin(const std::vector<T*> &data, Size nCells, Size nSets = 1) const;
+
+    template<class T>
+    void end(const std::vector<T*> &data, Size nCells, Size nSets = 1) const;
+
+    template<class T>
+    void exchange(const std::vector<T*> &data, Size nCells, Size nSets = 1) const
+    {
+        begin(data, nCells, nSets);
+        end(data, nCells, nSets);
+    }
+
+private:
+
+    struct Channel
+    {
+        std::vector<char> sendBuffer, recvBuffer;
+
+        std::vector<MPI_Request> requests;
+
+        bool active = false;
+    };
+
+    //- Returns the channel for messages of nBytes per cell, creating its persistent requests if necessary
+    Channel &channel(Size nBytes) const;
+
+    void start(Channel &channel) const;
+
+    void wait(Channel &channel) const;
+
+    std::shared_ptr<const Communicator> comm_;
+
+    //- Duplicate of the grid communicator, so that the tags of the persistent requests cannot match any other message
+    MPI_Comm haloComm_;
+
+    std::vector<int> neighbours_;
+
+    //- Local cell ids to send/receive, stored contiguously by neighbour
+    std::vector<Label> sendPtr_, sendIds_, recvPtr_, recvIds_;
+
+    mutable std::map<Size, Channel> channels_;
+};
+
+#include "HaloExchange.tpp"
+
+#endif
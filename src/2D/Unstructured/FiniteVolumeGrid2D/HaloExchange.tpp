@@ -0,0 +1,37 @@
+#include "HaloExchange.h"
+
+template<class T>
+void HaloExchange::begin(const std::vector<T*> &data, Size nCells, Size nSets) const
+{
+    Channel &ch = channel(sizeof(T) * data.size() * nSets);
+
+    if (ch.active)
+        throw Exception("HaloExchange", "begin", "an exchange of this message size is already in progress.");
+
+    T *buffer = reinterpret_cast<T*>(ch.sendBuffer.data());
+
+    for (Label id: sendIds_)
+        for (T *vals: data)
+            for (Size set = 0; set < nSets; ++set)
+                *buffer++ = vals[id + set * nCells];
+
+    start(ch);
+}
+
+template<class T>
+void HaloExchange::end(const std::vector<T*> &data, Size nCells, Size nSets) const
+{
+    Channel &ch = channel(sizeof(T) * data.size() * nSets);
+
+    if (!ch.active)
+        throw Exception("HaloExchange", "end", "no exchange of this message size is in progress.");
+
+    wait(ch);
+
+    const T *buffer = reinterpret_cast<const T*>(ch.recvBuffer.data());
+
+    for (Label id: recvIds_)
+        for (T *vals: data)
+            for (Size set = 0; set < nSets; ++set)
+                vals[id + set * nCells] = *buffer++;
+}
@@ -15,7 +15,9 @@ CgnsViewer::CgnsViewer(const Input &input, const Solver &solver)
     :
       Viewer(input, solver)
 {
-    boost::filesystem::path path = "solution/Proc" + std::to_string(solver.grid()->comm().rank());
+    path_ = "Proc" + std::to_string(solver.grid()->comm().rank());
+
+    boost::filesystem::path path = "solution/" + path_;
     boost::filesystem::create_directories(path);
 
     casename_ = input.caseInput().get<std::string>("CaseName");
@@ -62,10 +64,14 @@ CgnsViewer::CgnsViewer(const Input &input, const Solver &solver)
     file.close();
 }
 
-void CgnsViewer::write(Scalar time)
+CgnsViewer::~CgnsViewer()
 {
-    boost::filesystem::path path = "solution/" + std::to_string(time)
-            + "/Proc" + std::to_string(solver_.grid()->comm().rank());
+    finish();
+}
+
+void CgnsViewer::writeSnapshot(const Snapshot &snapshot)
+{
+    boost::filesystem::path path = "solution/" + std::to_string(snapshot.time) + "/" + path_;
 
     boost::filesystem::create_directories(path);
 
@@ -77,26 +83,14 @@ void CgnsViewer::write(Scalar time)
 
     int sid = file.writeSolution(bid, zid, "Solution");
 
-    for (const std::string &fieldname: integerFields_)
-    {
-        auto field = solver_.integerField(fieldname);
-        if (field)
-            file.writeField(bid, zid, sid, field->name(), *field);
-    }
+    for (const auto &field: snapshot.integerFields)
+        file.writeField(bid, zid, sid, field.first, field.second);
 
-    for (const std::string &fieldname: scalarFields_)
-    {
-        auto field = solver_.scalarField(fieldname);
-        if (field)
-            file.writeField(bid, zid, sid, field->name(), *field);
-    }
+    for (const auto &field: snapshot.scalarFields)
+        file.writeField(bid, zid, sid, field.first, field.second, precision(field.first));
 
-    for (const std::string &fieldname: vectorFields_)
-    {
-        auto field = solver_.vectorField(fieldname);
-        if (field)
-            file.writeField(bid, zid, sid, field->name(), *field);
-    }
+    for (const auto &field: snapshot.vectorFields)
+        file.writeField(bid, zid, sid, field.first, field.second, precision(field.first));
 
     path = boost::filesystem::path("../../../") / gridfile_;
 
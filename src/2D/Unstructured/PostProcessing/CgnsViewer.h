@@ -13,10 +13,12 @@ public:
 
     CgnsViewer(const Input& input, const Solver& solver);
 
-    virtual void write(Scalar time) override;
+    ~CgnsViewer();
 
 protected:
 
+    virtual void writeSnapshot(const Snapshot &snapshot) override;
+
     std::string path_, gridfile_, casename_;
 };
 
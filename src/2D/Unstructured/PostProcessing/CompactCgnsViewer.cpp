@@ -56,33 +56,26 @@ CompactCgnsViewer::CompactCgnsViewer(const Input &input, const Solver &solver)
     file.close();
 }
 
-void CompactCgnsViewer::write(Scalar time)
+CompactCgnsViewer::~CompactCgnsViewer()
+{
+    finish();
+}
+
+void CompactCgnsViewer::writeSnapshot(const Snapshot &snapshot)
 {
     CgnsFile file(filename_, CgnsFile::MODIFY);
 
     int sid = file.writeSolution(bid_, zid_, "FlowSolution" + std::to_string(++solnNo_));
-    file.writeDescriptorNode(bid_, zid_, sid, "SolutionTime", std::to_string(time));
-
-    for (const std::string &fieldname: integerFields_)
-    {
-        auto field = solver_.integerField(fieldname);
-        if (field)
-            file.writeField(bid_, zid_, sid, field->name(), *field);
-    }
-
-    for (const std::string &fieldname: scalarFields_)
-    {
-        auto field = solver_.scalarField(fieldname);
-        if (field)
-            file.writeField(bid_, zid_, sid, field->name(), *field);
-    }
-
-    for (const std::string &fieldname: vectorFields_)
-    {
-        auto field = solver_.vectorField(fieldname);
-        if (field)
-            file.writeField(bid_, zid_, sid, field->name(), *field);
-    }
+    file.writeDescriptorNode(bid_, zid_, sid, "SolutionTime", std::to_string(snapshot.time));
+
+    for (const auto &field: snapshot.integerFields)
+        file.writeField(bid_, zid_, sid, field.first, field.second);
+
+    for (const auto &field: snapshot.scalarFields)
+        file.writeField(bid_, zid_, sid, field.first, field.second, precision(field.first));
+
+    for (const auto &field: snapshot.vectorFields)
+        file.writeField(bid_, zid_, sid, field.first, field.second, precision(field.first));
 
     file.close();
 }
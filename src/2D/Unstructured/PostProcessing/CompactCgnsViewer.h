@@ -9,10 +9,12 @@ public:
 
     CompactCgnsViewer(const Input& input, const Solver& solver);
 
-    virtual void write(Scalar time) override;
+    ~CompactCgnsViewer();
 
 protected:
 
+    virtual void writeSnapshot(const Snapshot &snapshot) override;
+
     int bid_, zid_;
 
     std::size_t solnNo_;
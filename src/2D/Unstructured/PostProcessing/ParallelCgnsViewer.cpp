@@ -0,0 +1,176 @@
+#include <map>
+
+#include <boost/filesystem/operations.hpp>
+
+#include "ParallelCgnsViewer.h"
+
+ParallelCgnsViewer::ParallelCgnsViewer(const Input &input, const Solver &solver)
+    :
+      Viewer(input, solver)
+{
+    const Communicator &comm = solver.comm();
+    const FiniteVolumeGrid2D &grid = *solver.grid();
+
+    //- Global ids are split into contiguous blocks of nearly equal size
+    Label nCells = comm.sum(grid.localCells().size());
+
+    blockPtr_.resize(comm.nProcs() + 1);
+
+    for (int proc = 0; proc <= comm.nProcs(); ++proc)
+        blockPtr_[proc] = proc * nCells / comm.nProcs();
+
+    sendIds_.resize(comm.nProcs());
+    std::vector<std::vector<Label>> sendGlobalIds(comm.nProcs());
+
+    for (const Cell &cell: grid.localCells())
+    {
+        Label gid = grid.globalIds()[cell.id()];
+        int proc = std::upper_bound(blockPtr_.begin(), blockPtr_.end(), gid) - blockPtr_.begin() - 1;
+
+        sendIds_[proc].push_back(cell.id());
+        sendGlobalIds[proc].push_back(gid);
+    }
+
+    for (const std::vector<Label> &gids: comm.allToAllv(sendGlobalIds))
+        for (Label gid: gids)
+            recvOrder_.push_back(gid - blockPtr_[comm.rank()]);
+
+    if (comm.isMainProc())
+        boost::filesystem::create_directory("solution");
+
+    comm.barrier();
+
+    filename_ = "solution/Solution.cgns";
+    writeGrid(input.caseInput().get<std::string>("CaseName"));
+
+    //- Writes are MPI collectives, which the output thread cannot make as MPI is not initialized for threads
+    asyncWrite_ = false;
+}
+
+ParallelCgnsViewer::~ParallelCgnsViewer()
+{
+    finish();
+}
+
+void ParallelCgnsViewer::writeSnapshot(const Snapshot &snapshot)
+{
+    const Communicator &comm = solver_.comm();
+    int rmin = blockPtr_[comm.rank()] + 1, rmax = blockPtr_[comm.rank() + 1];
+
+    CgnsFile file(filename_, CgnsFile::MODIFY, comm.communicator());
+
+    timeValues_.push_back(snapshot.time);
+    solnNames_.push_back("FlowSolution" + std::to_string(solnNames_.size() + 1));
+
+    int sid = file.writeSolution(bid_, zid_, solnNames_.back());
+
+    for (const auto &field: snapshot.integerFields)
+        file.writeField(bid_, zid_, sid, field.first, rmin, rmax, blockValues(field.second));
+
+    for (const auto &field: snapshot.scalarFields)
+        file.writeField(bid_, zid_, sid, field.first, rmin, rmax, blockValues(field.second));
+
+    for (const auto &field: snapshot.vectorFields)
+        file.writeField(bid_, zid_, sid, field.first, rmin, rmax, blockValues(field.second));
+
+    file.writeIterativeData(bid_, zid_, timeValues_, solnNames_);
+    file.close();
+}
+
+template<class T>
+std::vector<T> ParallelCgnsViewer::blockValues(const std::vector<T> &field) const
+{
+    std::vector<std::vector<T>> sendVals(sendIds_.size());
+
+    for (int proc = 0; proc < sendIds_.size(); ++proc)
+        for (Label id: sendIds_[proc])
+            sendVals[proc].push_back(field[id]);
+
+    std::vector<T> vals(recvOrder_.size());
+    Label i = 0;
+
+    for (const std::vector<T> &recvVals: solver_.comm().allToAllv(sendVals))
+        for (const T &val: recvVals)
+            vals[recvOrder_[i++]] = val;
+
+    return vals;
+}
+
+void ParallelCgnsViewer::writeGrid(const std::string &casename)
+{
+    const Communicator &comm = solver_.comm();
+    const FiniteVolumeGrid2D &grid = *solver_.grid();
+
+    //- Send the vertices of the owned cells to the procs writing them
+    std::vector<std::vector<Label>> sendSizes(comm.nProcs());
+    std::vector<std::vector<Point2D>> sendCoords(comm.nProcs());
+
+    for (int proc = 0; proc < comm.nProcs(); ++proc)
+        for (Label id: sendIds_[proc])
+        {
+            const Cell &cell = grid.cells()[id];
+            sendSizes[proc].push_back(cell.nodes().size());
+
+            for (const Node &node: cell.nodes())
+                sendCoords[proc].push_back(node);
+        }
+
+    auto recvSizes = comm.allToAllv(sendSizes);
+    auto recvCoords = comm.allToAllv(sendCoords);
+
+    std::vector<std::vector<Point2D>> cellCoords(recvOrder_.size());
+    Label i = 0;
+
+    for (int proc = 0; proc < comm.nProcs(); ++proc)
+    {
+        auto coord = recvCoords[proc].begin();
+
+        for (Label nVerts: recvSizes[proc])
+        {
+            cellCoords[recvOrder_[i++]].assign(coord, coord + nVerts);
+            coord += nVerts;
+        }
+    }
+
+    //- Nodes are merged within a block, those on block boundaries are written once by each block using them
+    std::map<std::pair<Scalar, Scalar>, int> nodeIds;
+    std::vector<Point2D> nodes;
+    std::vector<int> eptr(1, 0), eind;
+
+    for (const std::vector<Point2D> &coords: cellCoords)
+    {
+        for (const Point2D &pt: coords)
+        {
+            auto insert = nodeIds.insert(std::make_pair(std::make_pair(pt.x, pt.y), (int) nodes.size()));
+
+            if (insert.second)
+                nodes.push_back(pt);
+
+            eind.push_back(insert.first->second);
+        }
+
+        eptr.push_back(eind.size());
+    }
+
+    auto nNodes = comm.allGather(nodes.size());
+    Label nodeOffset = std::accumulate(nNodes.begin(), nNodes.begin() + comm.rank(), 0ul);
+    Label nTotalNodes = std::accumulate(nNodes.begin(), nNodes.end(), 0ul);
+
+    std::transform(eind.begin(), eind.end(), eind.begin(), [nodeOffset](int id)
+    { return id + nodeOffset + 1; });
+
+    int rmin = blockPtr_[comm.rank()] + 1, rmax = blockPtr_[comm.rank() + 1];
+
+    CgnsFile file(filename_, CgnsFile::WRITE, comm.communicator());
+
+    bid_ = file.createBase(casename, 2, 2);
+    zid_ = file.createUnstructuredZone(bid_, "Cells", nTotalNodes, blockPtr_.back());
+
+    file.writeCoordinates(bid_, zid_, nodeOffset + 1, nodeOffset + nodes.size(), nodes);
+    file.writeMixedElementSection(bid_, zid_, "Cells", 1, blockPtr_.back(), rmin, rmax, eptr, eind);
+
+    //- Domain info
+    int sid = file.writeSolution(bid_, zid_, "Info");
+    file.writeField(bid_, zid_, sid, "ProcNo", rmin, rmax, blockValues(grid.cellOwnership()));
+    file.close();
+}
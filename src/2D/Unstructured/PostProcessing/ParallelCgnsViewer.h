@@ -0,0 +1,43 @@
+#ifndef PHASE_PARALLEL_CGNS_VIEWER_H
+#define PHASE_PARALLEL_CGNS_VIEWER_H
+
+#include "System/CgnsFile.h"
+
+#include "Viewer.h"
+
+//- Writes the grid and all solutions to a single file through parallel CGNS. Owned cells are redistributed so that
+//- each proc writes a contiguous block of global ids, and the file needs no reconstruction.
+class ParallelCgnsViewer : public Viewer
+{
+public:
+
+    ParallelCgnsViewer(const Input &input, const Solver &solver);
+
+    ~ParallelCgnsViewer();
+
+protected:
+
+    virtual void writeSnapshot(const Snapshot &snapshot) override;
+
+    //- Values of the owned cells, in global id order over this proc's block
+    template<class T>
+    std::vector<T> blockValues(const std::vector<T> &field) const;
+
+    void writeGrid(const std::string &casename);
+
+    int bid_, zid_;
+
+    //- Global ids [blockPtr_[proc], blockPtr_[proc + 1]) are written by proc
+    std::vector<Label> blockPtr_;
+
+    //- Owned cells sent to each proc, and the block position of each received value
+    std::vector<std::vector<Label>> sendIds_;
+
+    std::vector<Label> recvOrder_;
+
+    std::vector<Scalar> timeValues_;
+
+    std::vector<std::string> solnNames_;
+};
+
+#endif
@@ -1,6 +1,7 @@
 #include "PostProcessing.h"
 #include "CgnsViewer.h"
 #include "CompactCgnsViewer.h"
+#include "ParallelCgnsViewer.h"
 #include "IbTracker.h"
 #include "ImmersedBoundaryObjectProbe.h"
 #include "ImmersedBoundaryObjectContactLineTracker.h"
@@ -16,6 +17,8 @@ PostProcessing::PostProcessing(const Input &input, const Solver &solver)
         viewer_ = std::unique_ptr<Viewer>(new CgnsViewer(input, solver));
     else if(viewerType == "compactCgns")
         viewer_ = std::unique_ptr<Viewer>(new CompactCgnsViewer(input, solver));
+    else if(viewerType == "parallelCgns")
+        viewer_ = std::unique_ptr<Viewer>(new ParallelCgnsViewer(input, solver));
     else
         throw Exception("PostProcessing", "PostProcessing", "Unrecognized viewer type \"" + viewerType + "\".");
 }
@@ -1,3 +1,5 @@
+#include <iostream>
+
 #include <boost/filesystem.hpp>
 
 #include "Viewer.h"
@@ -18,4 +20,110 @@ Viewer::Viewer(const Input &input, const Solver &solver)
     split(integerFields_, integerFields, is_any_of(", "), token_compress_on);
     split(scalarFields_, scalarFields, is_any_of(", "), token_compress_on);
     split(vectorFields_, vectorFields, is_any_of(", "), token_compress_on);
+
+    string singlePrecisionFields = input.caseInput().get<string>("Viewer.singlePrecisionFields", "");
+    split(singlePrecisionFields_, singlePrecisionFields, is_any_of(", "), token_compress_on);
+
+    CgnsFile::setCompression(input.caseInput().get<int>("Viewer.compression", 0));
+
+    asyncWrite_ = input.caseInput().get<bool>("Viewer.asyncWrite", true);
+}
+
+Viewer::~Viewer()
+{
+    finish();
+}
+
+void Viewer::write(Scalar solutionTime)
+{
+    //- Staging overlaps with the pending write, which uses the other snapshot
+    Snapshot &snapshot = snapshots_[staged_];
+    stage(snapshot, solutionTime);
+    staged_ ^= 1;
+
+    wait();
+
+    if (asyncWrite_)
+        thread_ = std::thread([this, &snapshot]()
+        {
+            try
+            {
+                writeSnapshot(snapshot);
+            }
+            catch (...)
+            {
+                error_ = std::current_exception();
+            }
+        });
+    else
+        writeSnapshot(snapshot);
+}
+
+void Viewer::wait()
+{
+    if (thread_.joinable())
+        thread_.join();
+
+    if (error_)
+    {
+        std::exception_ptr error = error_;
+        error_ = nullptr;
+        std::rethrow_exception(error);
+    }
+}
+
+void Viewer::finish() noexcept
+{
+    try
+    {
+        wait();
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "Error writing solution output: " << e.what() << std::endl;
+    }
+    catch (...)
+    {
+        std::cerr << "Error writing solution output." << std::endl;
+    }
+}
+
+template<class T>
+static void stageField(std::vector<std::pair<std::string, std::vector<T>>> &fields, Size &nFields,
+                       const std::shared_ptr<FiniteVolumeField<T>> &field)
+{
+    if (!field)
+        return;
+
+    if (fields.size() == nFields)
+        fields.emplace_back();
+
+    fields[nFields].first = field->name();
+    fields[nFields].second.assign(field->begin(), field->end());
+    ++nFields;
+}
+
+void Viewer::stage(Snapshot &snapshot, Scalar solutionTime) const
+{
+    snapshot.time = solutionTime;
+
+    //- Buffers are reused between snapshots so that staging does not reallocate
+    Size nFields = 0;
+
+    for (const std::string &fieldname: integerFields_)
+        stageField(snapshot.integerFields, nFields, solver_.integerField(fieldname));
+
+    snapshot.integerFields.resize(nFields);
+    nFields = 0;
+
+    for (const std::string &fieldname: scalarFields_)
+        stageField(snapshot.scalarFields, nFields, solver_.scalarField(fieldname));
+
+    snapshot.scalarFields.resize(nFields);
+    nFields = 0;
+
+    for (const std::string &fieldname: vectorFields_)
+        stageField(snapshot.vectorFields, nFields, solver_.vectorField(fieldname));
+
+    snapshot.vectorFields.resize(nFields);
 }
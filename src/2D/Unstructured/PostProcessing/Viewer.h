@@ -1,8 +1,12 @@
 #ifndef PHASE_VIEWER_H
 #define PHASE_VIEWER_H
 
+#include <thread>
+#include <exception>
+
 #include "System/Input.h"
 #include "System/Communicator.h"
+#include "System/CgnsFile.h"
 #include "Solvers/Solver.h"
 
 class Viewer
@@ -11,16 +15,57 @@ public:
 
     Viewer(const Input& input, const Solver& solver);
 
-    virtual void write(Scalar solutionTime) = 0;
+    virtual ~Viewer();
+
+    //- Copies the output fields and writes them on the output thread, only blocks while a previous write is pending
+    void write(Scalar solutionTime);
+
+    //- Blocks until the pending write has finished, rethrowing any error it raised
+    void wait();
 
 protected:
 
+    //- Output fields copied at one solution time
+    struct Snapshot
+    {
+        Scalar time;
+        std::vector<std::pair<std::string, std::vector<int>>> integerFields;
+        std::vector<std::pair<std::string, std::vector<Scalar>>> scalarFields;
+        std::vector<std::pair<std::string, std::vector<Vector2D>>> vectorFields;
+    };
+
+    void stage(Snapshot &snapshot, Scalar solutionTime) const;
+
+    //- Joins the pending write and reports its error, must be called from every derived destructor
+    //- since the write still uses the derived members
+    void finish() noexcept;
+
+    CgnsFile::Precision precision(const std::string &fieldname) const
+    { return singlePrecisionFields_.count(fieldname) ? CgnsFile::SINGLE : CgnsFile::DOUBLE; }
+
+    //- Called from the output thread when writes are asynchronous, must not touch solver fields or communicate
+    virtual void writeSnapshot(const Snapshot &snapshot) = 0;
+
     const Solver& solver_;
 
     std::string filename_;
 
     std::unordered_set<std::string> integerFields_, scalarFields_, vectorFields_;
 
+    //- Real fields stored in single precision
+    std::unordered_set<std::string> singlePrecisionFields_;
+
+    //- Double-buffered output, one snapshot is staged while the other is written
+    bool asyncWrite_;
+
+    Snapshot snapshots_[2];
+
+    int staged_ = 0;
+
+    std::thread thread_;
+
+    std::exception_ptr error_;
+
 };
 
 #include "CgnsViewer.h"
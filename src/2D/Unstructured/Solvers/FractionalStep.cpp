@@ -94,7 +94,7 @@ Scalar FractionalStep::solveUEqn(Scalar timeStep)
     for (const Cell &cell: *fluid_)
         u_(cell) += timeStep * gradP_(cell);
 
-    grid_->sendMessages(u_);
+    u_.beginExchange();
     u_.interpolateFaces();
 
     return error;
@@ -16,6 +16,10 @@ FractionalStepAxisymmetricDFIB::FractionalStepAxisymmetricDFIB(const Input &inpu
       fib_(*addField<Vector2D>("fb", fluid_)),
       fibEqn_(input, fib_, "fbEqn")
 {
+    //- The least-squares stencils of the immersed boundary reach the diagonals of each cell
+    scalarIndexMap_->reserveIbStencils(*grid_);
+    vectorIndexMap_->reserveIbStencils(*grid_);
+
     ib_ = std::make_shared<DirectForcingImmersedBoundary>(input, grid, fluid_);
     addField<int>(ib_->cellStatus());
 
@@ -18,6 +18,10 @@ FractionalStepDFIB::FractionalStepDFIB(const Input &input, const std::shared_ptr
       //extEqn_(input, gradP_, "extEqn"),
       ib_(std::make_shared<DirectForcingImmersedBoundary>(input, grid, fluid_))
 {
+    //- The least-squares stencils of the immersed boundary reach the diagonals of each cell
+    scalarIndexMap_->reserveIbStencils(*grid_);
+    vectorIndexMap_->reserveIbStencils(*grid_);
+
     ib_->updateCells();
     addField<int>(ib_->cellStatus());
 }
@@ -69,7 +73,7 @@ Scalar FractionalStepDFIB::solveUEqn(Scalar timeStep)
     for(const Cell &c: u_.cells())
         u_(c) += timeStep * (fb_(c) + gradP_(c));
 
-    u_.sendMessages();
+    u_.beginExchange();
     u_.interpolateFaces();
 
     return error;
@@ -129,7 +133,7 @@ void FractionalStepDFIB::solveExtEqns()
     {
         if(ib_->localIbCells().isInSet(c))
         {
-            auto st = DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil(c, *ib_);
+            const auto &st = ib_->stencil(c);
             auto beta = st.interpolationCoeffs(c.centroid());
 
             eqn.add(c, c, -1.);
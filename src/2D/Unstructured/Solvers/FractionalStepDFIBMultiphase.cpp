@@ -56,8 +56,7 @@ void FractionalStepDirectForcingMultiphase::initialize()
     FractionalStepDFIB::initialize();
 
     //- Ensure the computation starts with a valid gamma field
-    gradGamma_.compute(*fluid_);
-    gradGamma_.sendMessages();
+    gradGamma_.computeAndExchange(*fluid_);
     updateProperties(0.);
 }
 
@@ -115,12 +114,11 @@ Scalar FractionalStepDirectForcingMultiphase::solveGammaEqn(Scalar timeStep)
     gammaEqn_ == cicsam::div(u_, gamma_, beta, 0.5) - cicsam::div(u_, gamma_, beta, 0.) + src::src(gammaSrc_);
 
     error = gammaEqn_.solve();
-    gamma_.sendMessages();
+    gamma_.beginExchange();
     gamma_.interpolateFaces();
 
     //- Update the gradient
-    gradGamma_.compute(*fluid_);
-    gradGamma_.sendMessages();
+    gradGamma_.computeAndExchange(*fluid_);
 
     return error;
 }
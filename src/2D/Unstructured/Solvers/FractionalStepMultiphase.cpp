@@ -5,6 +5,7 @@
 #include "FiniteVolume/Discretization/Laplacian.h"
 #include "FiniteVolume/Discretization/Source.h"
 #include "FiniteVolume/Discretization/Cicsam.h"
+#include "FiniteVolume/Discretization/Plic.h"
 
 #include "FractionalStepMultiphase.h"
 
@@ -27,6 +28,12 @@ FractionalStepMultiphase::FractionalStepMultiphase(const Input &input, const std
     mu1_ = input.caseInput().get<Scalar>("Properties.mu1", FractionalStep::mu_);
     mu2_ = input.caseInput().get<Scalar>("Properties.mu2", FractionalStep::mu_);
 
+    gammaScheme_ = input.caseInput().get<std::string>("Solver.gammaScheme", "cicsam");
+
+    if (gammaScheme_ != "cicsam" && gammaScheme_ != "plic")
+        throw Exception("FractionalStepMultiphase", "FractionalStepMultiphase",
+                        "unrecognized gamma scheme \"" + gammaScheme_ + "\".");
+
     capillaryTimeStep_ = std::numeric_limits<Scalar>::infinity();
     for (const Face &face: grid_->interiorFaces())
     {
@@ -76,24 +83,34 @@ Scalar FractionalStepMultiphase::solve(Scalar timeStep)
 
 Scalar FractionalStepMultiphase::solveGammaEqn(Scalar timeStep)
 {
-    auto beta = cicsam::faceInterpolationWeights(u_, gamma_, gradGamma_, timeStep);
+    //- For plic these are the geometric face fractions rather than interpolation weights
+    bool plic = gammaScheme_ == "plic";
+    auto beta = plic ? plic::faceFractions(u_, gamma_, gradGamma_, timeStep) :
+                       cicsam::faceInterpolationWeights(u_, gamma_, gradGamma_, timeStep);
 
     //- Advect volume fractions
     gamma_.savePreviousTimeStep(timeStep, 1);
-    gammaEqn_ = (fv::ddt(gamma_, timeStep) + cicsam::div(u_, gamma_, beta, 0.5) == 0.);
+    gammaEqn_ = (fv::ddt(gamma_, timeStep) + (plic ? plic::div(u_, gamma_, beta) : cicsam::div(u_, gamma_, beta, 0.5)) == 0.);
 
     Scalar error = gammaEqn_.solve();
-    gamma_.sendMessages();
+    gamma_.beginExchange();
     gamma_.interpolateFaces();
 
     //- Update the gradient
-    gradGamma_.compute(*fluid_);
-    gradGamma_.sendMessages();
+    gradGamma_.computeAndExchange(*fluid_);
 
     //- Must be the exact momentum flux used to calculate gamma
     rhoU_.savePreviousTimeStep(timeStep, 2);
-    cicsam::computeMomentumFlux(rho1_, rho2_, u_, gamma_, beta, rhoU_.oldField(0));
-    cicsam::computeMomentumFlux(rho1_, rho2_, u_, gamma_.oldField(0), beta, rhoU_.oldField(1));
+    if (plic)
+    {
+        plic::computeMomentumFlux(rho1_, rho2_, u_, gamma_, beta, rhoU_.oldField(0));
+        plic::computeMomentumFlux(rho1_, rho2_, u_, gamma_.oldField(0), beta, rhoU_.oldField(1));
+    }
+    else
+    {
+        cicsam::computeMomentumFlux(rho1_, rho2_, u_, gamma_, beta, rhoU_.oldField(0));
+        cicsam::computeMomentumFlux(rho1_, rho2_, u_, gamma_.oldField(0), beta, rhoU_.oldField(1));
+    }
 
     return error;
 }
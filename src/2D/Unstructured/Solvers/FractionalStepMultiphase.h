@@ -31,6 +31,9 @@ protected:
     //- Properties
     Scalar rho1_, rho2_, mu1_, mu2_, capillaryTimeStep_;
 
+    //- Volume fraction advection scheme, "cicsam" or "plic"
+    std::string gammaScheme_;
+
     //- Fields
     ScalarFiniteVolumeField &rho_, &mu_, &gamma_, &beta_;
 
@@ -1,13 +1,74 @@
 #include <math.h>
 #include <regex>
+#include <map>
+#include <fstream>
+#include <exception>
 
 #include <boost/algorithm/string.hpp>
 #include <boost/filesystem.hpp>
 
 #include "System/CgnsFile.h"
+#include "System/BinaryStream.h"
 
 #include "Solver.h"
 
+namespace
+{
+    const std::string checkpointFormat = "Phase checkpoint 1";
+
+    //- Fields are written in name order, so the files do not depend on the hashing of the field maps
+    template<class T>
+    void writeFields(std::ostream &os, const std::unordered_map<std::string, std::shared_ptr<FiniteVolumeField<T>>> &fields)
+    {
+        std::map<std::string, std::shared_ptr<FiniteVolumeField<T>>> sortedFields(fields.begin(), fields.end());
+
+        binary::write(os, (unsigned long) sortedFields.size());
+
+        for (const auto &entry: sortedFields)
+        {
+            binary::write(os, entry.first);
+            entry.second->writeCheckpoint(os);
+        }
+    }
+
+    template<class T>
+    void readFields(std::istream &is, const std::unordered_map<std::string, std::shared_ptr<FiniteVolumeField<T>>> &fields)
+    {
+        unsigned long nFields;
+        binary::read(is, nFields);
+
+        if (nFields != fields.size())
+            throw Exception("Solver", "readCheckpoint", "checkpoint has " + std::to_string(nFields)
+                                                        + " fields where the solver has " + std::to_string(fields.size()) + ".");
+
+        for (unsigned long i = 0; i < nFields; ++i)
+        {
+            std::string name;
+            binary::read(is, name);
+
+            auto field = fields.find(name);
+
+            if (field == fields.end())
+                throw Exception("Solver", "readCheckpoint", "solver has no field \"" + name + "\".");
+
+            field->second->readCheckpoint(is);
+        }
+    }
+
+    //- Every proc throws if any proc failed, so that none is left waiting in a later collective. The procs that failed
+    //- rethrow their own error
+    void throwOnAllProcs(const Communicator &comm, const std::exception_ptr &error, const std::string &methodName)
+    {
+        if (comm.min((int) !error) == 1)
+            return;
+
+        if (error)
+            std::rethrow_exception(error);
+
+        throw Exception("Solver", methodName, "failed on another proc.");
+    }
+}
+
 Solver::Solver(const Input &input, const std::shared_ptr<const FiniteVolumeGrid2D> &grid)
     :
       grid_(grid)
@@ -304,12 +365,162 @@ void Solver::setInitialConditions(const Input &input)
 
 void Solver::setInitialConditions(const CommandLine &cl, const Input &input)
 {
+    //- A checkpoint is read in place of the solution files, and then also replaces the initialization
     if (cl.get<bool>("restart"))
-        restartSolution(input);
+    {
+        if (!checkpointExists())
+            restartSolution(input);
+    }
     else
         setInitialConditions(input);
 }
 
+//- Checkpoints
+
+void Solver::writeCheckpoint(Scalar time, Scalar timeStep) const
+{
+    std::exception_ptr error;
+
+    try
+    {
+        if (grid_->comm().isMainProc())
+            boost::filesystem::create_directory("checkpoint");
+    }
+    catch (...)
+    {
+        error = std::current_exception();
+    }
+
+    throwOnAllProcs(grid_->comm(), error, "writeCheckpoint");
+
+    //- The file is renamed once complete on every proc, so a run killed while writing keeps the previous checkpoint
+    std::string filename = checkpointFilename();
+    std::ofstream fout(filename + ".tmp", std::ios::binary);
+
+    binary::write(fout, checkpointFormat);
+    binary::write(fout, grid_->comm().nProcs());
+    binary::write(fout, (unsigned long) grid_->cells().size());
+    binary::write(fout, (unsigned long) grid_->faces().size());
+    binary::write(fout, time);
+    binary::write(fout, timeStep);
+
+    //- The ib objects come first, as restoring them reclassifies the cells and overwrites the cell status
+    binary::write(fout, (bool) ib());
+
+    if (ib())
+        ib()->writeCheckpoint(fout);
+
+    writeFields(fout, integerFields_);
+    writeFields(fout, scalarFields_);
+    writeFields(fout, vectorFields_);
+    writeFields(fout, tensorFields_);
+
+    fout.close();
+
+    if (!fout)
+        error = std::make_exception_ptr(
+                    Exception("Solver", "writeCheckpoint", "failed to write \"" + filename + ".tmp\"."));
+
+    throwOnAllProcs(grid_->comm(), error, "writeCheckpoint");
+
+    try
+    {
+        boost::filesystem::rename(filename + ".tmp", filename);
+    }
+    catch (...)
+    {
+        error = std::current_exception();
+    }
+
+    throwOnAllProcs(grid_->comm(), error, "writeCheckpoint");
+}
+
+bool Solver::readCheckpoint(Scalar &time, Scalar &timeStep)
+{
+    if (!checkpointExists())
+        return false;
+
+    std::string filename = checkpointFilename();
+    std::ifstream fin(filename, std::ios::binary);
+    std::exception_ptr error;
+
+    //- Reading is split around the collective checks and reclassification of the cells, and every proc must succeed
+    //- before the next part is read
+    try
+    {
+        std::string format;
+        binary::read(fin, format);
+
+        if (format != checkpointFormat)
+            throw Exception("Solver", "readCheckpoint", "\"" + filename + "\" is not a checkpoint file.");
+
+        int nProcs;
+        unsigned long nCells, nFaces;
+        bool hasIb;
+
+        binary::read(fin, nProcs);
+        binary::read(fin, nCells);
+        binary::read(fin, nFaces);
+
+        if (nProcs != grid_->comm().nProcs() || nCells != grid_->cells().size() || nFaces != grid_->faces().size())
+            throw Exception("Solver", "readCheckpoint", "\"" + filename + "\" was written for a different decomposition.");
+
+        binary::read(fin, time);
+        binary::read(fin, timeStep);
+        binary::read(fin, hasIb);
+
+        if (hasIb != (bool) ib())
+            throw Exception("Solver", "readCheckpoint", "immersed boundaries of the checkpoint and solver do not match.");
+    }
+    catch (...)
+    {
+        error = std::current_exception();
+    }
+
+    throwOnAllProcs(grid_->comm(), error, "readCheckpoint");
+
+    //- Each proc renames its own file, so a run killed between the renames leaves files from different times
+    if (grid_->comm().min(time) != grid_->comm().max(time))
+        throw Exception("Solver", "readCheckpoint", "checkpoint files were written at different times, the last "
+                                                    "checkpoint was not completed on every proc.");
+
+    try
+    {
+        //- The solver owns its immersed boundary, only the accessor is const
+        if (ib())
+            std::const_pointer_cast<ImmersedBoundary>(ib())->readCheckpoint(fin);
+    }
+    catch (...)
+    {
+        error = std::current_exception();
+    }
+
+    throwOnAllProcs(grid_->comm(), error, "readCheckpoint");
+
+    if (ib())
+        std::const_pointer_cast<ImmersedBoundary>(ib())->updateCells();
+
+    try
+    {
+        readFields(fin, integerFields_);
+        readFields(fin, scalarFields_);
+        readFields(fin, vectorFields_);
+        readFields(fin, tensorFields_);
+    }
+    catch (...)
+    {
+        error = std::current_exception();
+    }
+
+    throwOnAllProcs(grid_->comm(), error, "readCheckpoint");
+
+    startTime_ = time;
+
+    grid_->comm().printf("Restarted from checkpoint at t = %lf s.\n", time);
+
+    return true;
+}
+
 //- Protected methods
 
 void Solver::setCircle(const Circle &circle, Scalar innerValue, ScalarFiniteVolumeField &field)
@@ -536,9 +747,25 @@ void Solver::restartSolution(const Input &input)
 
     CgnsFile file(path.string(), CgnsFile::READ);
 
+    //- Fields written in single precision cannot be restored exactly, so they are refused unless explicitly allowed
+    bool allowSinglePrecision = input.caseInput().get<bool>("Solver.allowSinglePrecisionRestart", false);
+
+    auto checkPrecision = [this, allowSinglePrecision](const CgnsFile::Field<Scalar> &field)
+    {
+        if (field.type != "RealSingle")
+            return;
+
+        if (!allowSinglePrecision)
+            throw Exception("Solver", "restartSolution", "field \"" + field.name + "\" was written in single precision. "
+                            "Remove it from Viewer.singlePrecisionFields, or set Solver.allowSinglePrecisionRestart.");
+
+        grid_->comm().printf("Warning: restarting field \"%s\" from single precision data.\n", field.name.c_str());
+    };
+
     for (const auto &entry: scalarFields_)
     {
         auto field = file.readField<Scalar>(1, 1, 1, 1, grid_->nCells(), entry.first);
+        checkPrecision(field);
 
         if (field.data.size() == entry.second->size())
             std::copy(field.data.begin(), field.data.end(), entry.second->begin());
@@ -551,6 +778,8 @@ void Solver::restartSolution(const Input &input)
     {
         auto fieldX = file.readField<Scalar>(1, 1, 1, 1, grid_->nCells(), entry.first + "X");
         auto fieldY = file.readField<Scalar>(1, 1, 1, 1, grid_->nCells(), entry.first + "Y");
+        checkPrecision(fieldX);
+        checkPrecision(fieldY);
 
         if (fieldX.data.size() == entry.second->size()
                 && fieldY.data.size() == entry.second->size())
@@ -568,3 +797,8 @@ void Solver::restartSolution(const Input &input)
 
     file.close();
 }
+
+bool Solver::checkpointExists() const
+{
+    return grid_->comm().min((int) boost::filesystem::exists(checkpointFilename())) == 1;
+}
@@ -79,6 +79,11 @@ public:
     virtual std::shared_ptr<const ImmersedBoundary> ib() const
     { return nullptr; }
 
+    //- Checkpoints, one raw binary file per proc holding the time, all fields with their history and the ib state
+    virtual void writeCheckpoint(Scalar time, Scalar timeStep) const override;
+
+    virtual bool readCheckpoint(Scalar &time, Scalar &timeStep) override;
+
 protected:
 
     void setCircle(const Circle &circle, Scalar innerValue, ScalarFiniteVolumeField &field);
@@ -105,6 +110,12 @@ protected:
 
     virtual void restartSolution(const Input &input);
 
+    std::string checkpointFilename() const
+    { return "checkpoint/Proc" + std::to_string(grid_->comm().rank()) + ".bin"; }
+
+    //- True if every proc has a checkpoint file, readCheckpoint also checks that they were written at the same time
+    bool checkpointExists() const;
+
     std::shared_ptr<const FiniteVolumeGrid2D> grid_;
 
     std::shared_ptr<IndexMap> scalarIndexMap_, vectorIndexMap_;
@@ -0,0 +1,193 @@
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+#include "System/Input.h"
+
+#include "FiniteVolumeGrid2D/FiniteVolumeGrid2DFactory.h"
+#include "Solvers/SolverFactory.h"
+
+//- Runs a small multiphase case for nSteps + nRestartSteps steps, and again from a checkpoint written after nSteps.
+//- The checkpoints written at the end of both runs hold the complete solver state, and must be identical
+namespace
+{
+    const int nSteps = 5, nRestartSteps = 5;
+
+    void writeCase()
+    {
+        boost::filesystem::create_directories("case");
+
+        std::ofstream("case/case.info") <<
+            "CaseName RestartTest\n"
+            "Solver\n"
+            "{\n"
+            "  type \"fractional step multiphase\"\n"
+            "  timeStep 2e-5\n"
+            "  maxCo 0.3\n"
+            "  smoothingKernelRadius 0.0005\n"
+            "  surfaceTensionModel CELESTE\n"
+            "}\n"
+            "LinearAlgebra\n"
+            "{\n"
+            "  uEqn\n"
+            "  {\n"
+            "    lib amesos\n"
+            "  }\n"
+            "  pEqn\n"
+            "  {\n"
+            "    lib amesos\n"
+            "  }\n"
+            "  gammaEqn\n"
+            "  {\n"
+            "    lib amesos\n"
+            "  }\n"
+            "}\n"
+            "Properties\n"
+            "{\n"
+            "  rho1 1\n"
+            "  rho2 998\n"
+            "  mu1 1.81e-5\n"
+            "  mu2 8.94e-4\n"
+            "  sigma 0.07262\n"
+            "  g (0,-9.8065)\n"
+            "}\n"
+            "Grid\n"
+            "{\n"
+            "  type rectilinear\n"
+            "  nCellsX 20\n"
+            "  nCellsY 10\n"
+            "  width 0.005\n"
+            "  height 0.0025\n"
+            "}\n";
+
+        std::ofstream("case/boundaries.info") <<
+            "Boundaries\n"
+            "{\n"
+            "  u\n"
+            "  {\n"
+            "    *\n"
+            "    {\n"
+            "      type fixed\n"
+            "      value (0,0)\n"
+            "    }\n"
+            "  }\n"
+            "  p\n"
+            "  {\n"
+            "    *\n"
+            "    {\n"
+            "      type normal_gradient\n"
+            "      value 0\n"
+            "    }\n"
+            "    y+\n"
+            "    {\n"
+            "      type fixed\n"
+            "      value 0\n"
+            "    }\n"
+            "  }\n"
+            "  gamma\n"
+            "  {\n"
+            "    *\n"
+            "    {\n"
+            "      type normal_gradient\n"
+            "      value 0\n"
+            "    }\n"
+            "  }\n"
+            "}\n";
+
+        std::ofstream("case/initialConditions.info") <<
+            "InitialConditions\n"
+            "{\n"
+            "  gamma\n"
+            "  {\n"
+            "    droplet\n"
+            "    {\n"
+            "      type circle\n"
+            "      radius 0.0008\n"
+            "      center (0.0025,0.0014)\n"
+            "      value 1\n"
+            "    }\n"
+            "  }\n"
+            "}\n";
+
+        std::ofstream("case/postProcessing.info") <<
+            "PostProcessing\n"
+            "{\n"
+            "  fileWriteFrequency 1\n"
+            "}\n";
+    }
+
+    void run(Solver &solver, Scalar maxCo, Scalar &time, Scalar &timeStep, int nSteps)
+    {
+        for (int i = 0; i < nSteps; ++i, time += timeStep, timeStep = solver.computeMaxTimeStep(maxCo, timeStep))
+            solver.solve(timeStep);
+    }
+
+    //- Writes a checkpoint and returns its contents
+    std::vector<char> checkpoint(const Solver &solver, Scalar time, Scalar timeStep)
+    {
+        solver.writeCheckpoint(time, timeStep);
+
+        std::ifstream fin("checkpoint/Proc" + std::to_string(solver.comm().rank()) + ".bin", std::ios::binary);
+        return std::vector<char>(std::istreambuf_iterator<char>(fin), std::istreambuf_iterator<char>());
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    Communicator::init(argc, argv);
+
+    bool identical;
+
+    //- Scoped so that the solvers are destroyed before MPI is finalized
+    {
+        Communicator comm;
+
+        if (comm.isMainProc())
+        {
+            boost::filesystem::remove_all("checkpoint");
+            writeCase();
+        }
+
+        comm.barrier();
+
+        Input input;
+        input.parseInputFile();
+
+        auto grid = FiniteVolumeGrid2DFactory::create(FiniteVolumeGrid2DFactory::RECTILINEAR, input);
+        Scalar maxCo = input.caseInput().get<Scalar>("Solver.maxCo");
+
+        //- Uninterrupted run, checkpointed part way
+        auto solver = SolverFactory::create(input, grid);
+        solver->setInitialConditions(input);
+        solver->initialize();
+
+        Scalar time = solver->getStartTime();
+        Scalar timeStep = solver->maxTimeStep();
+
+        run(*solver, maxCo, time, timeStep, nSteps);
+        solver->writeCheckpoint(time, timeStep);
+
+        //- Restarted run, which is not initialized as in RunControl
+        auto restartedSolver = SolverFactory::create(input, grid);
+        Scalar restartedTime, restartedTimeStep;
+
+        if (!restartedSolver->readCheckpoint(restartedTime, restartedTimeStep))
+            throw Exception("PhaseRestartTest", "main", "checkpoint was not read.");
+
+        run(*restartedSolver, maxCo, restartedTime, restartedTimeStep, nRestartSteps);
+        std::vector<char> restarted = checkpoint(*restartedSolver, restartedTime, restartedTimeStep);
+
+        run(*solver, maxCo, time, timeStep, nRestartSteps);
+        std::vector<char> uninterrupted = checkpoint(*solver, time, timeStep);
+
+        identical = comm.min((int) (restarted == uninterrupted)) == 1;
+
+        comm.printf("Restarted and uninterrupted states are %s.\n", identical ? "identical" : "different");
+    }
+
+    Communicator::finalize();
+
+    return identical ? 0 : 1;
+}
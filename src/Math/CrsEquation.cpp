@@ -1,10 +1,7 @@
+#include <algorithm>
 #include <numeric>
 
-#include "CrsEquation.h"
-
-std::vector<Index> CrsEquation::tmpRowPtr_, CrsEquation::tmpColInd_;
-
-std::vector<Scalar> CrsEquation::tmpVals_;
+#include "CrsEquationSum.h"
 
 CrsEquation::CrsEquation(Size nRows, Size nnz)
     :
@@ -17,6 +14,43 @@ CrsEquation::CrsEquation(Size nRows, Size nnz)
     std::partial_sum(rowPtr_.begin(), rowPtr_.end(), rowPtr_.begin());
 }
 
+CrsEquation::CrsEquation(const std::vector<Size> &nnz)
+    :
+      rowPtr_(nnz.size() + 1, 0),
+      rhs_(nnz.size(), 0.)
+{
+    std::partial_sum(nnz.begin(), nnz.end(), rowPtr_.begin() + 1);
+    colInd_.resize(rowPtr_.back(), -1);
+    vals_.resize(rowPtr_.back(), 0.);
+}
+
+CrsEquation::CrsEquation(const std::vector<Index> &rowPtr, const std::vector<Index> &colInd, Size nnz)
+    :
+      rhs_(rowPtr.size() - 1, 0.)
+{
+    Size nRows = rowPtr.size() - 1;
+
+    if(nnz == 0)
+    {
+        rowPtr_ = rowPtr;
+        colInd_ = colInd;
+    }
+    else
+    {
+        rowPtr_.resize(nRows + 1, 0);
+
+        for(Label row = 0; row < nRows; ++row)
+            rowPtr_[row + 1] = rowPtr_[row] + std::max<Index>(rowPtr[row + 1] - rowPtr[row], nnz);
+
+        colInd_.resize(rowPtr_.back(), -1);
+
+        for(Label row = 0; row < nRows; ++row)
+            std::copy(colInd.begin() + rowPtr[row], colInd.begin() + rowPtr[row + 1], colInd_.begin() + rowPtr_[row]);
+    }
+
+    vals_.resize(colInd_.size(), 0.);
+}
+
 CrsEquation &CrsEquation::operator=(const CrsEquation &eqn)
 {
     if(this != &eqn)
@@ -217,102 +251,14 @@ Scalar CrsEquation::solveLeastSquares()
 //- Operators
 CrsEquation& CrsEquation::operator +=(const CrsEquation &rhs)
 {
-    tmpRowPtr_.clear();
-    tmpColInd_.clear();
-    tmpVals_.clear();
-
-    tmpRowPtr_.emplace_back(0);
-
-    for(auto row = 0; row < rank(); ++row)
-    {
-        tmpRowPtr_.emplace_back(tmpRowPtr_.back());
-
-        for(auto j = rowPtr_[row]; j < rowPtr_[row + 1]; ++j)
-        {
-            if(vals_[j] == 0. || colInd_[j] < 0)
-                continue;
-
-            tmpColInd_.emplace_back(colInd_[j]);
-            tmpVals_.emplace_back(vals_[j]);
-            ++tmpRowPtr_.back();
-        }
-
-        for(auto j = rhs.rowPtr_[row]; j < rhs.rowPtr_[row + 1]; ++j)
-        {
-            if(rhs.vals_[j] == 0. || rhs.colInd_[j] < 0)
-                continue;
-
-            auto first = tmpColInd_.begin() + tmpRowPtr_[row];
-            auto last = tmpColInd_.begin() + tmpRowPtr_[row + 1];
-
-            auto it = std::find(first, last, rhs.colInd_[j]);
-
-            if(it != last)
-                tmpVals_[it - tmpColInd_.begin()] += rhs.vals_[j];
-            else
-            {
-                tmpColInd_.emplace_back(rhs.colInd_[j]);
-                tmpVals_.emplace_back(rhs.vals_[j]);
-                ++tmpRowPtr_.back();
-            }
-        }
-    }
-
-    rowPtr_ = tmpRowPtr_;
-    colInd_ = tmpColInd_;
-    vals_ = tmpVals_;
-
+    merge(rhs, 1.);
     rhs_ += rhs.rhs_;
     return *this;
 }
 
 CrsEquation& CrsEquation::operator -=(const CrsEquation &rhs)
 {
-    tmpRowPtr_.clear();
-    tmpColInd_.clear();
-    tmpVals_.clear();
-
-    tmpRowPtr_.emplace_back(0);
-
-    for(auto row = 0; row < rank(); ++row)
-    {
-        tmpRowPtr_.emplace_back(tmpRowPtr_.back());
-
-        for(auto j = rowPtr_[row]; j < rowPtr_[row + 1]; ++j)
-        {
-            if(vals_[j] == 0. || colInd_[j] < 0)
-                continue;
-
-            tmpColInd_.emplace_back(colInd_[j]);
-            tmpVals_.emplace_back(vals_[j]);
-            ++tmpRowPtr_.back();
-        }
-
-        for(auto j = rhs.rowPtr_[row]; j < rhs.rowPtr_[row + 1]; ++j)
-        {
-            if(rhs.vals_[j] == 0. || rhs.colInd_[j] < 0)
-                continue;
-
-            auto first = tmpColInd_.begin() + tmpRowPtr_[row];
-            auto last = tmpColInd_.begin() + tmpRowPtr_[row + 1];
-
-            auto it = std::find(first, last, rhs.colInd_[j]);
-
-            if(it != last)
-                tmpVals_[it - tmpColInd_.begin()] -= rhs.vals_[j];
-            else
-            {
-                tmpColInd_.emplace_back(rhs.colInd_[j]);
-                tmpVals_.emplace_back(-rhs.vals_[j]);
-                ++tmpRowPtr_.back();
-            }
-        }
-    }
-
-    rowPtr_ = tmpRowPtr_;
-    colInd_ = tmpColInd_;
-    vals_ = tmpVals_;
-
+    merge(rhs, -1.);
     rhs_ -= rhs.rhs_;
     return *this;
 }
@@ -343,41 +289,121 @@ CrsEquation &CrsEquation::operator/=(Scalar rhs)
     return *this;
 }
 
-CrsEquation &CrsEquation::operator==(Scalar rhs)
+CrsEquation &CrsEquation::operator==(Scalar rhs) &
 {
     if(rhs != 0.)
         rhs_ -= rhs;
     return *this;
 }
 
-CrsEquation &CrsEquation::operator==(const CrsEquation &rhs)
+CrsEquation &CrsEquation::operator==(const CrsEquation &rhs) &
 {
     return operator -=(rhs);
 }
 
-CrsEquation &CrsEquation::operator==(const Vector &rhs)
+CrsEquation &CrsEquation::operator==(const Vector &rhs) &
 {
     return operator -=(rhs);
 }
 
-std::ostream &operator<<(std::ostream &os, const CrsEquation &eqn)
+CrsEquation &CrsEquation::operator==(CrsEquationSum rhs) &
 {
-    for(auto row = 0; row < eqn.rowPtr().size() - 1; ++row)
-        for(auto j = eqn.rowPtr()[row]; j < eqn.rowPtr()[row + 1]; ++j)
-            os << "(" << row << "," << eqn.colInd()[j] << "," << eqn.vals()[j] << ")\n";
-    return os;
+    return operator -=(rhs.evaluate());
 }
 
-CrsEquation operator +(CrsEquation lhs, const CrsEquation &rhs)
+//- Protected
+
+CrsEquation &CrsEquation::merge(const CrsEquation &rhs, Scalar sign)
 {
-    lhs += rhs;
-    return lhs;
+    Size nRows = rank();
+
+    //- Equations assembled on the same sparsity pattern are added slot by slot, which also preserves the pattern
+    if(hasSameLayout(rhs))
+    {
+#pragma omp parallel for
+        for (Label j = 0; j < vals_.size(); ++j)
+            vals_[j] += sign * rhs.vals_[j];
+
+        return *this;
+    }
+    std::vector<Index> rowPtr(nRows + 1, 0);
+
+    //- Count the merged entries of each row, so that the rows can then be written independently
+#pragma omp parallel
+    {
+        std::vector<Index> cols;
+        std::vector<Scalar> vals;
+
+#pragma omp for
+        for (Label row = 0; row < nRows; ++row)
+        {
+            Size nnz = capacity(row) + rhs.capacity(row);
+
+            if (cols.size() < nnz)
+            {
+                cols.resize(nnz);
+                vals.resize(nnz);
+            }
+
+            rowPtr[row + 1] = mergeRow(row, rhs, sign, cols.data(), vals.data());
+        }
+    }
+
+    std::partial_sum(rowPtr.begin(), rowPtr.end(), rowPtr.begin());
+
+    std::vector<Index> colInd(rowPtr.back());
+    std::vector<Scalar> vals(rowPtr.back());
+
+#pragma omp parallel for
+    for (Label row = 0; row < nRows; ++row)
+        mergeRow(row, rhs, sign, colInd.data() + rowPtr[row], vals.data() + rowPtr[row]);
+
+    rowPtr_ = std::move(rowPtr);
+    colInd_ = std::move(colInd);
+    vals_ = std::move(vals);
+
+    return *this;
 }
 
-CrsEquation operator -(CrsEquation lhs, const CrsEquation &rhs)
+Size CrsEquation::mergeRow(Index row, const CrsEquation &rhs, Scalar sign, Index *cols, Scalar *vals) const
 {
-    lhs -= rhs;
-    return lhs;
+    Size n = 0;
+
+    for (auto j = rowPtr_[row]; j < rowPtr_[row + 1]; ++j)
+    {
+        //- Zero coefficients keep their slots, so that a merge does not change the sparsity pattern
+        if (colInd_[j] < 0)
+            continue;
+
+        cols[n] = colInd_[j];
+        vals[n++] = vals_[j];
+    }
+
+    for (auto j = rhs.rowPtr_[row]; j < rhs.rowPtr_[row + 1]; ++j)
+    {
+        if (rhs.colInd_[j] < 0)
+            continue;
+
+        auto it = std::find(cols, cols + n, rhs.colInd_[j]);
+
+        if (it != cols + n)
+            vals[it - cols] += sign * rhs.vals_[j];
+        else
+        {
+            cols[n] = rhs.colInd_[j];
+            vals[n++] = sign * rhs.vals_[j];
+        }
+    }
+
+    return n;
+}
+
+std::ostream &operator<<(std::ostream &os, const CrsEquation &eqn)
+{
+    for(auto row = 0; row < eqn.rowPtr().size() - 1; ++row)
+        for(auto j = eqn.rowPtr()[row]; j < eqn.rowPtr()[row + 1]; ++j)
+            os << "(" << row << "," << eqn.colInd()[j] << "," << eqn.vals()[j] << ")\n";
+    return os;
 }
 
 CrsEquation operator +(CrsEquation lhs, const Vector &rhs)
@@ -3,6 +3,8 @@
 
 #include "SparseMatrixSolver.h"
 
+class CrsEquationSum;
+
 class CrsEquation
 {
 public:
@@ -11,6 +13,11 @@ public:
 
     CrsEquation(Size nRows, Size nnz);
 
+    CrsEquation(const std::vector<Size> &nnz);
+
+    //- Initialize from a precomputed sparsity pattern, optionally padding each row to nnz entries
+    CrsEquation(const std::vector<Index> &rowPtr, const std::vector<Index> &colInd, Size nnz = 0);
+
     CrsEquation(const CrsEquation &eqn) = default;
 
     CrsEquation(CrsEquation &&eqn) = default;
@@ -40,11 +47,20 @@ public:
 
     void addRows(Size nRows, Size nnz);
 
-    //- Add/set
+    //- Add/set, a row with no free slot is grown, which is not safe while other rows are assembled concurrently
     void addCoeff(Index localRow, Index globalCol, Scalar val);
 
     void setCoeff(Index localRow, Index globalCol, Scalar val);
 
+    //- Add directly to a known slot of a row, falls back to a search if the slot holds another column
+    void addCoeffAt(Index localRow, Size slot, Index globalCol, Scalar val)
+    {
+        if(slot < capacity(localRow) && colInd_[rowPtr_[localRow] + slot] == globalCol)
+            vals_[rowPtr_[localRow] + slot] += val;
+        else
+            addCoeff(localRow, globalCol, val);
+    }
+
     void scaleRow(Index localRow, Scalar val);
 
     void addRhs(Index localRow, Scalar val)
@@ -118,17 +134,26 @@ public:
 
     CrsEquation &operator/=(Scalar rhs);
 
-    CrsEquation &operator==(Scalar rhs);
+    //- Equality operators only apply in place to named equations, temporaries form a CrsEquationSum instead
+    CrsEquation &operator==(Scalar rhs) &;
 
-    CrsEquation &operator==(const CrsEquation &rhs);
+    CrsEquation &operator==(const CrsEquation &rhs) &;
 
-    CrsEquation &operator==(const Vector &rhs);
+    CrsEquation &operator==(const Vector &rhs) &;
+
+    CrsEquation &operator==(CrsEquationSum rhs) &;
 
 protected:
 
-    static std::vector<Index> tmpRowPtr_, tmpColInd_;
+    friend class CrsEquationSum;
+
+    bool hasSameLayout(const CrsEquation &other) const
+    { return rowPtr_ == other.rowPtr_ && colInd_ == other.colInd_; }
+
+    //- Merge rows (rows are merged concurrently when OpenMP is enabled)
+    CrsEquation &merge(const CrsEquation &rhs, Scalar sign);
 
-    static std::vector<Scalar> tmpVals_;
+    Size mergeRow(Index row, const CrsEquation &rhs, Scalar sign, Index *cols, Scalar *vals) const;
 
     std::vector<Index> rowPtr_, colInd_;
 
@@ -143,10 +168,6 @@ protected:
 
 std::ostream& operator<<(std::ostream &os, const CrsEquation &eqn);
 
-CrsEquation operator +(CrsEquation lhs, const CrsEquation &rhs);
-
-CrsEquation operator -(CrsEquation lhs, const CrsEquation &rhs);
-
 CrsEquation operator +(CrsEquation lhs, const Vector &rhs);
 
 CrsEquation operator -(CrsEquation lhs, const Vector &rhs);
@@ -0,0 +1,172 @@
+#include <algorithm>
+
+#include "CrsEquationSum.h"
+
+CrsEquationSum::CrsEquationSum(CrsEquation eqn)
+{
+    eqns_.push_back(std::move(eqn));
+    eqnScales_.push_back(1.);
+}
+
+CrsEquationSum &CrsEquationSum::operator+=(CrsEquationSum rhs)
+{
+    std::move(rhs.eqns_.begin(), rhs.eqns_.end(), std::back_inserter(eqns_));
+    eqnScales_.insert(eqnScales_.end(), rhs.eqnScales_.begin(), rhs.eqnScales_.end());
+    std::move(rhs.srcs_.begin(), rhs.srcs_.end(), std::back_inserter(srcs_));
+    srcScales_.insert(srcScales_.end(), rhs.srcScales_.begin(), rhs.srcScales_.end());
+    shift_ += rhs.shift_;
+    return *this;
+}
+
+CrsEquationSum &CrsEquationSum::operator-=(CrsEquationSum rhs)
+{
+    return operator+=(std::move(rhs *= -1.));
+}
+
+CrsEquationSum &CrsEquationSum::operator+=(Vector rhs)
+{
+    srcs_.push_back(std::move(rhs));
+    srcScales_.push_back(1.);
+    return *this;
+}
+
+CrsEquationSum &CrsEquationSum::operator-=(Vector rhs)
+{
+    srcs_.push_back(std::move(rhs));
+    srcScales_.push_back(-1.);
+    return *this;
+}
+
+CrsEquationSum &CrsEquationSum::operator+=(Scalar rhs)
+{
+    shift_ += rhs;
+    return *this;
+}
+
+CrsEquationSum &CrsEquationSum::operator-=(Scalar rhs)
+{
+    shift_ -= rhs;
+    return *this;
+}
+
+CrsEquationSum &CrsEquationSum::operator*=(Scalar rhs)
+{
+    std::for_each(eqnScales_.begin(), eqnScales_.end(), [rhs](Scalar &scale) { scale *= rhs; });
+    std::for_each(srcScales_.begin(), srcScales_.end(), [rhs](Scalar &scale) { scale *= rhs; });
+    shift_ *= rhs;
+    return *this;
+}
+
+CrsEquationSum &CrsEquationSum::operator/=(Scalar rhs)
+{
+    return operator*=(1. / rhs);
+}
+
+CrsEquation CrsEquationSum::evaluate()
+{
+    CrsEquation eqn = std::move(eqns_[0]);
+    Size nTerms = eqns_.size();
+
+    bool fused = std::all_of(eqns_.begin() + 1, eqns_.end(), [&eqn](const CrsEquation &term)
+    { return eqn.hasSameLayout(term); });
+
+    if (fused)
+    {
+        //- All coefficients are combined in one pass, directly into the storage of the first term
+#pragma omp parallel for
+        for (Label j = 0; j < eqn.vals_.size(); ++j)
+        {
+            Scalar val = eqnScales_[0] * eqn.vals_[j];
+
+            for (Label i = 1; i < nTerms; ++i)
+                val += eqnScales_[i] * eqns_[i].vals_[j];
+
+            eqn.vals_[j] = val;
+        }
+    }
+    else
+    {
+        std::for_each(eqn.vals_.begin(), eqn.vals_.end(), [this](Scalar &val) { val *= eqnScales_[0]; });
+
+        for (Label i = 1; i < nTerms; ++i)
+            eqn.merge(eqns_[i], eqnScales_[i]);
+    }
+
+#pragma omp parallel for
+    for (Label row = 0; row < eqn.rhs_.size(); ++row)
+    {
+        Scalar val = eqnScales_[0] * eqn.rhs_(row) + shift_;
+
+        for (Label i = 1; i < nTerms; ++i)
+            val += eqnScales_[i] * eqns_[i].rhs_(row);
+
+        for (Label i = 0; i < srcs_.size(); ++i)
+            val += srcScales_[i] * srcs_[i](row);
+
+        eqn.rhs_(row) = val;
+    }
+
+    eqns_.clear();
+    eqnScales_.clear();
+    srcs_.clear();
+    srcScales_.clear();
+    shift_ = 0.;
+
+    return eqn;
+}
+
+//- Operators
+
+CrsEquationSum operator+(CrsEquationSum lhs, CrsEquationSum rhs)
+{
+    lhs += std::move(rhs);
+    return lhs;
+}
+
+CrsEquationSum operator-(CrsEquationSum lhs, CrsEquationSum rhs)
+{
+    lhs -= std::move(rhs);
+    return lhs;
+}
+
+CrsEquationSum operator+(CrsEquationSum lhs, Vector rhs)
+{
+    lhs += std::move(rhs);
+    return lhs;
+}
+
+CrsEquationSum operator-(CrsEquationSum lhs, Vector rhs)
+{
+    lhs -= std::move(rhs);
+    return lhs;
+}
+
+CrsEquationSum operator*(CrsEquationSum lhs, Scalar rhs)
+{
+    lhs *= rhs;
+    return lhs;
+}
+
+CrsEquationSum operator/(CrsEquationSum lhs, Scalar rhs)
+{
+    lhs /= rhs;
+    return lhs;
+}
+
+CrsEquationSum operator==(CrsEquationSum lhs, CrsEquationSum rhs)
+{
+    lhs -= std::move(rhs);
+    return lhs;
+}
+
+CrsEquationSum operator==(CrsEquationSum lhs, Vector rhs)
+{
+    lhs -= std::move(rhs);
+    return lhs;
+}
+
+CrsEquationSum operator==(CrsEquationSum lhs, Scalar rhs)
+{
+    lhs -= rhs;
+    return lhs;
+}
@@ -0,0 +1,68 @@
+#ifndef PHASE_CRS_EQUATION_SUM_H
+#define PHASE_CRS_EQUATION_SUM_H
+
+#include "CrsEquation.h"
+
+//- Linear combination of equations and source vectors whose merge is deferred. Each term is still a fully assembled
+//- equation, only combining them waits until the sum is evaluated, in a single pass over the coefficients when all
+//- terms share a sparsity pattern.
+class CrsEquationSum
+{
+public:
+
+    CrsEquationSum(CrsEquation eqn);
+
+    //- Operators
+    CrsEquationSum &operator+=(CrsEquationSum rhs);
+
+    CrsEquationSum &operator-=(CrsEquationSum rhs);
+
+    CrsEquationSum &operator+=(Vector rhs);
+
+    CrsEquationSum &operator-=(Vector rhs);
+
+    CrsEquationSum &operator+=(Scalar rhs);
+
+    CrsEquationSum &operator-=(Scalar rhs);
+
+    CrsEquationSum &operator*=(Scalar rhs);
+
+    CrsEquationSum &operator/=(Scalar rhs);
+
+    //- Evaluate, consumes the terms
+    CrsEquation evaluate();
+
+protected:
+
+    std::vector<CrsEquation> eqns_;
+
+    std::vector<Scalar> eqnScales_;
+
+    std::vector<Vector> srcs_;
+
+    std::vector<Scalar> srcScales_;
+
+    Scalar shift_ = 0.;
+};
+
+//- Operators
+
+CrsEquationSum operator+(CrsEquationSum lhs, CrsEquationSum rhs);
+
+CrsEquationSum operator-(CrsEquationSum lhs, CrsEquationSum rhs);
+
+CrsEquationSum operator+(CrsEquationSum lhs, Vector rhs);
+
+CrsEquationSum operator-(CrsEquationSum lhs, Vector rhs);
+
+CrsEquationSum operator*(CrsEquationSum lhs, Scalar rhs);
+
+CrsEquationSum operator/(CrsEquationSum lhs, Scalar rhs);
+
+CrsEquationSum operator==(CrsEquationSum lhs, CrsEquationSum rhs);
+
+CrsEquationSum operator==(CrsEquationSum lhs, Vector rhs);
+
+CrsEquationSum operator==(CrsEquationSum lhs, Scalar rhs);
+
+#endif
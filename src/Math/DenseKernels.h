@@ -0,0 +1,183 @@
+#ifndef PHASE_DENSE_KERNELS_H
+#define PHASE_DENSE_KERNELS_H
+
+#include <cmath>
+#include <algorithm>
+
+#include "Types/Types.h"
+
+//- Inline kernels for small row-major dense matrices. StaticMatrix calls them with compile-time sizes so the loops are
+//- unrolled, Matrix calls them for run-time sizes up to maxSmallSize, where LAPACK/BLAS call overhead dominates.
+namespace dense
+{
+    const int maxSmallSize = 16;
+
+    inline bool isSmall(int m, int n)
+    { return m <= maxSmallSize && n <= maxSmallSize; }
+
+    //- C = A * B, with A m x n and B n x k
+    inline void gemm(int m, int n, int k, const Scalar *A, const Scalar *B, Scalar *C)
+    {
+        std::fill(C, C + m * k, 0.);
+
+        for (int i = 0; i < m; ++i)
+            for (int l = 0; l < n; ++l)
+            {
+                Scalar a = A[i * n + l];
+
+                for (int j = 0; j < k; ++j)
+                    C[i * k + j] += a * B[l * k + j];
+            }
+    }
+
+    //- LU factorization with partial pivoting in place, returns false if A is singular
+    inline bool lu(int n, Scalar *A, int *ipiv)
+    {
+        for (int j = 0; j < n; ++j)
+        {
+            int p = j;
+
+            for (int i = j + 1; i < n; ++i)
+                if (std::abs(A[i * n + j]) > std::abs(A[p * n + j]))
+                    p = i;
+
+            ipiv[j] = p;
+
+            if (A[p * n + j] == 0.)
+                return false;
+
+            if (p != j)
+                std::swap_ranges(A + j * n, A + (j + 1) * n, A + p * n);
+
+            for (int i = j + 1; i < n; ++i)
+            {
+                Scalar l = A[i * n + j] /= A[j * n + j];
+
+                for (int k = j + 1; k < n; ++k)
+                    A[i * n + k] -= l * A[j * n + k];
+            }
+        }
+
+        return true;
+    }
+
+    //- Overwrites the n x k matrix B with the solution of A X = B, given the factorization from lu
+    inline void luSolve(int n, int k, const Scalar *LU, const int *ipiv, Scalar *B)
+    {
+        for (int i = 0; i < n; ++i)
+            if (ipiv[i] != i)
+                std::swap_ranges(B + i * k, B + (i + 1) * k, B + ipiv[i] * k);
+
+        for (int i = 1; i < n; ++i)
+            for (int l = 0; l < i; ++l)
+                for (int j = 0; j < k; ++j)
+                    B[i * k + j] -= LU[i * n + l] * B[l * k + j];
+
+        for (int i = n - 1; i >= 0; --i)
+        {
+            for (int l = i + 1; l < n; ++l)
+                for (int j = 0; j < k; ++j)
+                    B[i * k + j] -= LU[i * n + l] * B[l * k + j];
+
+            for (int j = 0; j < k; ++j)
+                B[i * k + j] /= LU[i * n + i];
+        }
+    }
+
+    //- Inverse of A in Ainv, A is overwritten by its factorization. Returns false if A is singular
+    inline bool invert(int n, Scalar *A, int *ipiv, Scalar *Ainv)
+    {
+        if (!lu(n, A, ipiv))
+            return false;
+
+        for (int i = 0; i < n; ++i)
+            for (int j = 0; j < n; ++j)
+                Ainv[i * n + j] = i == j ? 1. : 0.;
+
+        luSolve(n, n, A, ipiv, Ainv);
+
+        return true;
+    }
+
+    //- Least-squares pseudo-inverse P (n x m) of A (m x n, m >= n) by Householder QR, A is overwritten and work must
+    //- hold m * m values. Returns false if A is rank deficient, in which case P is not set
+    inline bool qrPseudoInverse(int m, int n, Scalar *A, Scalar *P, Scalar *work)
+    {
+        Scalar *Qt = work;
+
+        for (int i = 0; i < m; ++i)
+            for (int j = 0; j < m; ++j)
+                Qt[i * m + j] = i == j ? 1. : 0.;
+
+        Scalar normA = 0.;
+
+        for (int i = 0; i < m * n; ++i)
+            normA = std::max(normA, std::abs(A[i]));
+
+        for (int j = 0; j < n; ++j)
+        {
+            Scalar sigma = 0.;
+
+            for (int i = j; i < m; ++i)
+                sigma += A[i * n + j] * A[i * n + j];
+
+            sigma = std::sqrt(sigma);
+
+            if (sigma <= 1e-14 * normA)
+                return false;
+
+            //- The reflector v = x - alpha e_j is stored below the diagonal, with v_j kept separately
+            Scalar alpha = A[j * n + j] > 0. ? -sigma : sigma;
+            Scalar vj = A[j * n + j] - alpha;
+            Scalar vtv = vj * vj + sigma * sigma - A[j * n + j] * A[j * n + j];
+
+            A[j * n + j] = alpha;
+
+            for (int k = j + 1; k < n; ++k)
+            {
+                Scalar s = vj * A[j * n + k];
+
+                for (int i = j + 1; i < m; ++i)
+                    s += A[i * n + j] * A[i * n + k];
+
+                s *= 2. / vtv;
+
+                A[j * n + k] -= s * vj;
+
+                for (int i = j + 1; i < m; ++i)
+                    A[i * n + k] -= s * A[i * n + j];
+            }
+
+            for (int k = 0; k < m; ++k)
+            {
+                Scalar s = vj * Qt[j * m + k];
+
+                for (int i = j + 1; i < m; ++i)
+                    s += A[i * n + j] * Qt[i * m + k];
+
+                s *= 2. / vtv;
+
+                Qt[j * m + k] -= s * vj;
+
+                for (int i = j + 1; i < m; ++i)
+                    Qt[i * m + k] -= s * A[i * n + j];
+            }
+        }
+
+        //- P = R^-1 Q^T, using the first n rows of Q^T
+        for (int i = n - 1; i >= 0; --i)
+            for (int k = 0; k < m; ++k)
+            {
+                Scalar s = Qt[i * m + k];
+
+                for (int l = i + 1; l < n; ++l)
+                    s -= A[i * n + l] * P[l * m + k];
+
+                P[i * m + k] = s / A[i * n + i];
+            }
+
+        return true;
+    }
+}
+
+#endif
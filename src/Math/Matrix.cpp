@@ -15,6 +15,7 @@ extern "C"
 
 #include "System/Exception.h"
 
+#include "DenseKernels.h"
 #include "Matrix.h"
 
 Matrix Matrix::_tmp;
@@ -120,6 +121,32 @@ Matrix &Matrix::operator/=(Scalar rhs)
 
 Matrix &Matrix::solve(Matrix &b)
 {
+    if (dense::isSmall(m_, n_) && b.n_ <= dense::maxSmallSize)
+    {
+        if (isSquare())
+        {
+            if (!dense::lu(m_, data(), ipiv_.data()))
+                throw Exception("Matrix", "solve", "coefficient matrix is singular to working precision.");
+
+            dense::luSolve(m_, b.n_, data(), ipiv_.data(), b.data());
+            return b;
+        }
+        else if (m_ > n_)
+        {
+            Scalar pInv[dense::maxSmallSize * dense::maxSmallSize], work[dense::maxSmallSize * dense::maxSmallSize];
+            std::vector<Scalar> A(vals_);
+
+            if (dense::qrPseudoInverse(m_, n_, A.data(), pInv, work))
+            {
+                Scalar x[dense::maxSmallSize * dense::maxSmallSize];
+                dense::gemm(n_, m_, b.n_, pInv, b.data(), x);
+                std::copy(x, x + n_ * b.n_, b.data());
+                b.m_ = n_;
+                return b;
+            }
+        }
+    }
+
     if (isSquare())
         LAPACKE_dgesv(LAPACK_ROW_MAJOR, m_, b.n_, data(), n_, ipiv_.data(), b.data(), b.n_);
     else
@@ -180,6 +207,17 @@ Matrix &Matrix::transpose()
 
 Matrix &Matrix::invert()
 {
+    if (isSquare() && dense::isSmall(m_, n_))
+    {
+        Scalar inv[dense::maxSmallSize * dense::maxSmallSize];
+
+        if (!dense::invert(m_, data(), ipiv_.data(), inv))
+            throw Exception("Matrix", "invert", "inversion failed, matrix is singular to working precision.");
+
+        std::copy(inv, inv + m_ * n_, vals_.begin());
+        return *this;
+    }
+
     lapack_int info1 = LAPACKE_dgetrf(LAPACK_ROW_MAJOR, m_, n_, data(), n_, ipiv_.data());
     lapack_int info2 = LAPACKE_dgetri(LAPACK_ROW_MAJOR, m_, data(), n_, ipiv_.data());
 
@@ -191,6 +229,16 @@ Matrix &Matrix::invert()
 
 Matrix &Matrix::pinvert()
 {
+    if (m_ >= n_ && dense::isSmall(m_, n_))
+    {
+        Scalar work[dense::maxSmallSize * dense::maxSmallSize];
+        std::vector<Scalar> A(vals_);
+        _tmp.resize(n_, m_);
+
+        if (dense::qrPseudoInverse(m_, n_, A.data(), _tmp.data(), work))
+            return (*this = _tmp);
+    }
+
     _tmp.setIdentity(std::max(m_, n_));
     LAPACKE_dgels(LAPACK_ROW_MAJOR, 'N', m_, n_, _tmp.n(), data(), n_, _tmp.data(), _tmp.n());
     _tmp.resize(n_, m_);
@@ -260,6 +308,15 @@ Matrix inverse(Matrix mat)
 
 Matrix pseudoInverse(Matrix mat)
 {
+    if (mat.m() >= mat.n() && dense::isSmall(mat.m(), mat.n()))
+    {
+        Scalar work[dense::maxSmallSize * dense::maxSmallSize];
+        Matrix QR(mat), pInv(mat.n(), mat.m());
+
+        if (dense::qrPseudoInverse(mat.m(), mat.n(), QR.data(), pInv.data(), work))
+            return pInv;
+    }
+
     Matrix I = eye(std::max(mat.m(), mat.n()));
     LAPACKE_dgels(LAPACK_ROW_MAJOR, 'N', mat.m(), mat.n(), I.n(), mat.data(), mat.n(), I.data(), I.n());
     I.resize(mat.n(), mat.m());
@@ -295,6 +352,12 @@ Matrix operator*(const Matrix &A, const Matrix &B)
 {
     Matrix C(A.m(), B.n());
 
+    if (dense::isSmall(A.m(), A.n()) && B.n() <= dense::maxSmallSize)
+    {
+        dense::gemm(A.m(), A.n(), B.n(), A.data(), B.data(), C.data());
+        return C;
+    }
+
     cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans,
                 A.m(), B.n(), A.n(), 1., A.data(), A.n(),
                 B.data(), B.n(), 1., C.data(), C.n());
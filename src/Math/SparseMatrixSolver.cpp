@@ -38,6 +38,20 @@ Scalar SparseMatrixSolver::solve(const Vector &x0)
     return solve();
 }
 
+void SparseMatrixSolver::setNumVectors(int nVectors)
+{
+    if (nVectors != 1)
+        throw Exception("SparseMatrixSolver", "setNumVectors", "multiple right-hand sides are not supported by this sparse matrix solver type.");
+}
+
+Scalar SparseMatrixSolver::x(Index idx, int vec) const
+{
+    if (vec != 0)
+        throw Exception("SparseMatrixSolver", "x", "multiple right-hand sides are not supported by this sparse matrix solver type.");
+
+    return x(idx);
+}
+
 Scalar SparseMatrixSolver::solveLeastSquares()
 {
     throw Exception("SparseMatrixSolver", "solveLeastSquares", "least squares solver is not available for this sparse matrix solver type.");
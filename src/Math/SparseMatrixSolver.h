@@ -49,6 +49,14 @@ public:
 
     virtual Scalar x(Index idx) const = 0;
 
+    //- Multiple right-hand sides sharing one matrix, the rhs and guess vectors hold each vector contiguously
+    virtual bool supportsMultipleRhs() const
+    { return false; }
+
+    virtual void setNumVectors(int nVectors);
+
+    virtual Scalar x(Index idx, int vec) const;
+
     virtual void setup(const boost::property_tree::ptree &parameters)
     {}
 
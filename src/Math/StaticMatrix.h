@@ -6,6 +6,7 @@
 
 #include "Types/Types.h"
 #include "System/Exception.h"
+#include "DenseKernels.h"
 
 #ifdef __INTEL_COMPILER
 #include <mkl.h>
@@ -103,12 +104,13 @@ public:
     StaticMatrix<M, N> &invert()
     {
         static_assert(M == N, "Matrix must be square.");
-        lapack_int info1 = LAPACKE_dgetrf(LAPACK_ROW_MAJOR, M, N, vals_, N, ipiv_);
-        lapack_int info2 = LAPACKE_dgetri(LAPACK_ROW_MAJOR, M, vals_, N, ipiv_);
+        Scalar inv[M * N];
 
-        if (info1 != 0 || info2 != 0)
+        if (!dense::invert(M, vals_, ipiv_, inv))
             throw Exception("StaticMatrix", "invert", "matrix inversion failed.");
 
+        std::copy(inv, inv + M * N, vals_);
+
         return *this;
     };
 
@@ -116,7 +118,11 @@ public:
     void solve(StaticMatrix<M, K> &b)
     {
         static_assert(M == N, "Coefficient matrix must be square.");
-        LAPACKE_dgesv(LAPACK_ROW_MAJOR, M, K, vals_, N, ipiv_, b.data(), K);
+
+        if (!dense::lu(M, vals_, ipiv_))
+            throw Exception("StaticMatrix", "solve", "coefficient matrix is singular.");
+
+        dense::luSolve(M, K, vals_, ipiv_, b.data());
     }
 
     StaticMatrix<M, N> &operator*=(Scalar scalar)
@@ -138,7 +144,7 @@ public:
 private:
 
     Scalar vals_[M * N];
-    lapack_int ipiv_[M];
+    int ipiv_[M];
 };
 
 template<int M>
@@ -160,6 +166,17 @@ StaticMatrix<M, M> inverse(StaticMatrix<M, M> A)
 template<int M, int N>
 StaticMatrix<N, M> pseudoInverse(StaticMatrix<M, N> A)
 {
+    if (M >= N)
+    {
+        StaticMatrix<M, N> QR = A;
+        StaticMatrix<N, M> pInv;
+        Scalar work[M * M];
+
+        if (dense::qrPseudoInverse(M, N, QR.data(), pInv.data(), work))
+            return pInv;
+    }
+
+    //- Underdetermined or rank deficient systems fall back to LAPACK
     StaticMatrix<M, M> I = eye<M>();
     LAPACKE_dgels(LAPACK_ROW_MAJOR, 'N', M, N, M, A.data(), N, I.data(), M);
     StaticMatrix<N, M> pInv;
@@ -205,11 +222,7 @@ template<int M, int N, int K>
 StaticMatrix<M, K> operator*(const StaticMatrix<M, N> &A, const StaticMatrix<N, K> &B)
 {
     StaticMatrix<M, K> C;
-
-    cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans,
-                A.m(), B.n(), A.n(), 1., A.data(), A.n(),
-                B.data(), B.n(), 1., C.data(), C.n());
-
+    dense::gemm(M, N, K, A.data(), B.data(), C.data());
     return C;
 }
 
@@ -42,6 +42,8 @@ void TrilinosAmesosSparseMatrixSolver::setup(const boost::property_tree::ptree &
 {
     using namespace Teuchos;
 
+    TrilinosSparseMatrixSolver::setup(parameters);
+
     solverName_ = parameters.get<std::string>("solver", solverName_);
 
     std::string filename = parameters.get<std::string>("amesosParamFile", "");
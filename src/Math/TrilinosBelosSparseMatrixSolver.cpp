@@ -15,28 +15,31 @@ TrilinosBelosSparseMatrixSolver::TrilinosBelosSparseMatrixSolver(const Communica
     linearProblem_ = rcp(new LinearProblem());
 }
 
-void TrilinosBelosSparseMatrixSolver::setRank(int rank)
+Scalar TrilinosBelosSparseMatrixSolver::solve()
 {
     using namespace Teuchos;
     typedef Tpetra::RowMatrix<Scalar, Index, Index> TpetraRowMatrix;
 
-    TrilinosSparseMatrixSolver::setRank(rank);
-
-    precon_ = Ifpack2::Factory().create(precType_, rcp_static_cast<const TpetraRowMatrix>(mat_));
-    precon_->setParameters(*ifpackParams_);
-    linearProblem_->setOperator(mat_);
-    linearProblem_->setRightPrec(precon_);
-}
+    //- A new preconditioner is only required if the matrix object has changed
+    if (precon_.is_null() || precon_->getMatrix().get() != mat_.get())
+    {
+        precon_ = Ifpack2::Factory().create(precType_, rcp_static_cast<const TpetraRowMatrix>(mat_));
+        precon_->setParameters(*ifpackParams_);
+        linearProblem_->setOperator(mat_);
+        linearProblem_->setRightPrec(precon_);
+    }
 
-Scalar TrilinosBelosSparseMatrixSolver::solve()
-{
     comm_.printf("Ifpack2: Computing preconditioner...\n");
-    precon_->initialize();
+
+    if (!precon_->isInitialized())
+        precon_->initialize();
+
     precon_->compute();
 
     comm_.printf("Belos: Performing Krylov iterations...\n");
     linearProblem_->setProblem(x_, b_);
-    solver_->solve();
+    activeSolver_ = nVectors_ > 1 ? blockSolver_ : solver_;
+    activeSolver_->solve();
 
     return error();
 }
@@ -45,6 +48,8 @@ void TrilinosBelosSparseMatrixSolver::setup(const boost::property_tree::ptree& p
 {
     typedef Belos::SolverFactory<Scalar, TpetraMultiVector, TpetraOperator> SolverFactory;
 
+    TrilinosSparseMatrixSolver::setup(parameters);
+
     std::string filename = parameters.get<std::string>("belosParamFile", "");
 
     if(filename.empty())
@@ -58,6 +63,10 @@ void TrilinosBelosSparseMatrixSolver::setup(const boost::property_tree::ptree& p
     solver_ = SolverFactory().create(parameters.get<std::string>("solver", "BICGSTAB"), belosParams_);
     solver_->setProblem(linearProblem_);
 
+    blockSolver_ = SolverFactory().create(parameters.get<std::string>("blockSolver", "PSEUDOBLOCK GMRES"), belosParams_);
+    blockSolver_->setProblem(linearProblem_);
+    activeSolver_ = solver_;
+
     precType_ = parameters.get<std::string>("preconditioner", "schwarz");
     filename = parameters.get<std::string>("ifpackParamFile", "");
 
@@ -81,12 +90,12 @@ void TrilinosBelosSparseMatrixSolver::setup(const boost::property_tree::ptree& p
 
 int TrilinosBelosSparseMatrixSolver::nIters() const
 {
-    return solver_->getNumIters();
+    return activeSolver_->getNumIters();
 }
 
 Scalar TrilinosBelosSparseMatrixSolver::error() const
 {
-    return solver_->achievedTol();
+    return activeSolver_->achievedTol();
 }
 
 void TrilinosBelosSparseMatrixSolver::printStatus(const std::string &msg) const
@@ -15,8 +15,6 @@ public:
     Type type() const
     { return TRILINOS_BELOS; }
 
-    void setRank(int rank);
-
     Scalar solve();
 
     void setup(const boost::property_tree::ptree &parameters);
@@ -25,6 +23,9 @@ public:
 
     Scalar error() const;
 
+    bool supportsMultipleRhs() const
+    { return true; }
+
     void printStatus(const std::string &msg) const;
 
 private:
@@ -42,6 +43,9 @@ private:
     //- Solver data structures
     Teuchos::RCP<LinearProblem> linearProblem_;
     Teuchos::RCP<Solver> solver_;
+
+    //- Block solver used when there are multiple right-hand sides, and the solver used by the last solve
+    Teuchos::RCP<Solver> blockSolver_, activeSolver_;
     Teuchos::RCP<Preconditioner> precon_;
 };
 
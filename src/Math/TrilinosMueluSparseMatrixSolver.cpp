@@ -1,6 +1,11 @@
+#include <limits>
+
 #include <MueLu_ParameterListInterpreter.hpp>
 #include <MueLu_CreateTpetraPreconditioner.hpp>
 #include <BelosSolverFactory.hpp>
+#include <boost/algorithm/string.hpp>
+
+#include "System/Exception.h"
 
 #include "TrilinosMueluSparseMatrixSolver.h"
 
@@ -19,23 +24,38 @@ TrilinosMueluSparseMatrixSolver::TrilinosMueluSparseMatrixSolver(const Communica
     solver_->setProblem(linearProblem_);
 }
 
-void TrilinosMueluSparseMatrixSolver::setRank(int rank)
-{
-    TrilinosSparseMatrixSolver::setRank(rank);
-    linearProblem_->setOperator(mat_);
-}
-
 Scalar TrilinosMueluSparseMatrixSolver::solve()
 {
-    precon_ = MueLu::CreateTpetraPreconditioner(
-                Teuchos::rcp_static_cast<TpetraOperator>(mat_),
-                *mueluParams_,
-                coords_);
+    if (precon_.is_null()
+            || rebuildPrecon_
+            || nPreconUses_ >= maxPreconUses_
+            || !precon_->getRangeMap()->isSameAs(*mat_->getRangeMap()))
+    {
+        comm_.printf("MueLu: Building multigrid hierarchy...\n");
+
+        precon_ = MueLu::CreateTpetraPreconditioner(
+                    Teuchos::rcp_static_cast<TpetraOperator>(mat_),
+                    *mueluParams_,
+                    coords_);
+
+        nPreconUses_ = 0;
+    }
+    else if (preconReuse_ == SYMBOLIC)
+    {
+        comm_.printf("MueLu: Recomputing multigrid hierarchy from the existing symbolic setup...\n");
+        MueLu::ReuseTpetraPreconditioner(mat_, *precon_);
+    }
+
+    ++nPreconUses_;
 
+    linearProblem_->setOperator(mat_);
     linearProblem_->setProblem(x_, b_);
     linearProblem_->setLeftPrec(precon_);
     solver_->solve();
 
+    //- A hierarchy that is no longer effective is rebuilt on the next solve
+    rebuildPrecon_ = preconRebuildIters_ > 0 && nIters() > preconRebuildIters_;
+
     return error();
 }
 
@@ -46,6 +66,8 @@ void TrilinosMueluSparseMatrixSolver::setup(const boost::property_tree::ptree &p
 
     typedef Belos::SolverFactory<Scalar, TpetraMultiVector, TpetraOperator> SolverFactory;
 
+    TrilinosSparseMatrixSolver::setup(parameters);
+
     std::string belosParamFile = parameters.get<std::string>("belosParamFile");
     std::string mueluParamFile = parameters.get<std::string>("mueluParamFile");
     std::string solverName = parameters.get<std::string>("solver", "GMRES");
@@ -56,6 +78,29 @@ void TrilinosMueluSparseMatrixSolver::setup(const boost::property_tree::ptree &p
 
     linearProblem_ = rcp(new LinearProblem());
     solver_->setProblem(linearProblem_);
+
+    //- Multigrid hierarchy reuse policy
+    std::string preconReuse = parameters.get<std::string>("preconReuse", "none");
+    boost::algorithm::to_lower(preconReuse);
+
+    if (preconReuse == "none")
+        preconReuse_ = NONE;
+    else if (preconReuse == "full")
+        preconReuse_ = FULL;
+    else if (preconReuse == "symbolic")
+    {
+        preconReuse_ = SYMBOLIC;
+
+        //- A reuse type from the parameter file takes precedence
+        if (!mueluParams_->isParameter("reuse: type"))
+            mueluParams_->set("reuse: type", "symbolic");
+    }
+    else
+        throw Exception("TrilinosMueluSparseMatrixSolver", "setup", "bad preconditioner reuse type \"" + preconReuse + "\".");
+
+    maxPreconUses_ = preconReuse_ == NONE ? 1 : parameters.get<int>("maxPreconUses", std::numeric_limits<int>::max());
+    preconRebuildIters_ = parameters.get<int>("preconRebuildIters", 0);
+    rebuildPrecon_ = true;
 }
 
 int TrilinosMueluSparseMatrixSolver::nIters() const
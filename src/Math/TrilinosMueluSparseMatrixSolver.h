@@ -14,14 +14,17 @@ class TrilinosMueluSparseMatrixSolver : public TrilinosSparseMatrixSolver
 {
 public:
 
+    enum PreconReuse
+    {
+        NONE, FULL, SYMBOLIC
+    };
+
     TrilinosMueluSparseMatrixSolver(const Communicator &comm,
                                     const std::string &solverName = "TFQMR");
 
     Type type() const
     { return TRILINOS_MUELU; }
 
-    void setRank(int rank);
-
     Scalar solve();
 
     void setup(const boost::property_tree::ptree &parameters);
@@ -52,7 +55,12 @@ private:
 
     Teuchos::RCP<Preconditioner> precon_;
 
+    //- Hierarchy reuse
+    PreconReuse preconReuse_ = NONE;
+
+    int preconRebuildIters_ = 0;
 
+    bool rebuildPrecon_ = true;
 };
 
 #endif
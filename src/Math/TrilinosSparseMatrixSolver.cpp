@@ -20,7 +20,7 @@ TrilinosSparseMatrixSolver::TrilinosSparseMatrixSolver(const Communicator &comm,
     Tcomm_ = Teuchos::rcp_dynamic_cast<const TeuchosComm>(mat_->getComm(), true);
     x_ = rcp(new TpetraMultiVector(mat->getDomainMap(), 1, true));
     b_ = rcp(new TpetraMultiVector(mat->getRangeMap(), 1, true));
-    xData_ = x_->getData(0);
+    xData_.assign(1, x_->getData(0));
 }
 
 void TrilinosSparseMatrixSolver::setRank(int rank)
@@ -39,18 +39,38 @@ void TrilinosSparseMatrixSolver::setRank(int rowRank, int colRank)
     {
         rangeMap_ = rangeMap;
         domainMap_ = domainMap;
-        x_ = rcp(new TpetraMultiVector(domainMap, 1, true));
-        b_ = rcp(new TpetraMultiVector(rangeMap, 1, true));
-        xData_ = x_->getData(0);
+        x_ = null;
+        graph_ = null;
     }
 
-    mat_ = rcp(new TpetraCrsMatrix(rangeMap, 20, pftype_));
+    if (x_.is_null() || x_->getNumVectors() != (Size) nVectors_)
+    {
+        x_ = rcp(new TpetraMultiVector(domainMap_, nVectors_, true));
+        b_ = rcp(new TpetraMultiVector(rangeMap_, nVectors_, true));
+        xData_.clear();
+
+        for (int vec = 0; vec < nVectors_; ++vec)
+            xData_.push_back(x_->getData(vec));
+    }
+
+    if (staticGraph_ && !graph_.is_null())
+        return; //- keep the matrix, the values are refreshed when set is called
+
+    resetMatrix();
+}
+
+void TrilinosSparseMatrixSolver::setup(const boost::property_tree::ptree &parameters)
+{
+    staticGraph_ = parameters.get<bool>("staticGraph", false);
 }
 
 void TrilinosSparseMatrixSolver::set(const CoefficientList &eqn)
 {
     using namespace Teuchos;
 
+    if (!graph_.is_null())
+        resetMatrix();
+
     mat_->resumeFill();
     mat_->setAllToScalar(0.);
 
@@ -80,6 +100,22 @@ void TrilinosSparseMatrixSolver::set(const std::vector<Index> &rowPtr, const std
 {
     using namespace Teuchos;
 
+    if (staticGraph_)
+    {
+        if (graph_.is_null() || rowPtr != graphRowPtr_ || colInds != graphColInd_)
+            buildGraph(rowPtr, colInds);
+
+        //- Values are written straight into the local matrix, the graph and fill state are untouched
+        auto values = mat_->getLocalMatrix().values;
+        Kokkos::deep_copy(values, 0.);
+
+        for (Index j = 0, nnz = valOffsets_.size(); j < nnz; ++j)
+            if (valOffsets_[j] >= 0)
+                values(valOffsets_[j]) += vals[j];
+
+        return;
+    }
+
     mat_->resumeFill();
     mat_->setAllToScalar(0.);
 
@@ -105,6 +141,9 @@ void TrilinosSparseMatrixSolver::set(const std::vector<SparseEntry> &entries)
 {
     using namespace Teuchos;
 
+    if (!graph_.is_null())
+        resetMatrix();
+
     mat_->resumeFill();
     mat_->setAllToScalar(0.);
 
@@ -118,12 +157,24 @@ void TrilinosSparseMatrixSolver::set(const std::vector<SparseEntry> &entries)
 
 void TrilinosSparseMatrixSolver::setGuess(const Vector &x0)
 {
-    x_->getDataNonConst(0).assign(std::begin(x0.data()), std::end(x0.data()));
+    Size n = x0.size() / nVectors_;
+
+    for (int vec = 0; vec < nVectors_; ++vec)
+        x_->getDataNonConst(vec).assign(std::begin(x0.data()) + vec * n, std::begin(x0.data()) + (vec + 1) * n);
 }
 
 void TrilinosSparseMatrixSolver::setRhs(const Vector &rhs)
 {
-    b_->getDataNonConst(0).assign(std::begin(rhs.data()), std::end(rhs.data()));
+    Size n = rhs.size() / nVectors_;
+
+    for (int vec = 0; vec < nVectors_; ++vec)
+        b_->getDataNonConst(vec).assign(std::begin(rhs.data()) + vec * n, std::begin(rhs.data()) + (vec + 1) * n);
+}
+
+void TrilinosSparseMatrixSolver::setNumVectors(int nVectors)
+{
+    //- The vectors are rebuilt on the next call to setRank
+    nVectors_ = nVectors;
 }
 
 Scalar TrilinosSparseMatrixSolver::solveLeastSquares()
@@ -138,6 +189,7 @@ Scalar TrilinosSparseMatrixSolver::solveLeastSquares()
     A->apply(*b_, *b, Teuchos::TRANS);
 
     mat_ = C;
+    graph_ = Teuchos::null;
     b_ = b;
     //- x_ should already have the correct domain map
 
@@ -152,6 +204,70 @@ void TrilinosSparseMatrixSolver::printStatus(const std::string &msg) const
     comm_ << msg << " iterations = " << nIters() << ", error = " << error() << ".\n";
 }
 
+//- Protected
+
+void TrilinosSparseMatrixSolver::resetMatrix()
+{
+    mat_ = Teuchos::rcp(new TpetraCrsMatrix(rangeMap_, 20, pftype_));
+    graph_ = Teuchos::null;
+}
+
+void TrilinosSparseMatrixSolver::buildGraph(const std::vector<Index> &rowPtr, const std::vector<Index> &colInds)
+{
+    using namespace Teuchos;
+
+    Index minGlobalIndex = rangeMap_->getMinGlobalIndex();
+    Size nLocalRows = rowPtr.size() - 1;
+
+    ArrayRCP<size_t> nEntries(nLocalRows, 0);
+
+    for (Index localRow = 0; localRow < nLocalRows; ++localRow)
+        nEntries[localRow] = std::count_if(colInds.begin() + rowPtr[localRow],
+                                           colInds.begin() + rowPtr[localRow + 1],
+                                           [](Index idx) { return idx >= 0; });
+
+    auto graph = rcp(new TpetraCrsGraph(rangeMap_, nEntries, Tpetra::StaticProfile));
+
+    std::vector<Index> cols;
+
+    for (Index localRow = 0; localRow < nLocalRows; ++localRow)
+    {
+        cols.clear();
+        std::copy_if(colInds.begin() + rowPtr[localRow],
+                     colInds.begin() + rowPtr[localRow + 1],
+                     std::back_inserter(cols),
+                     [](Index idx) { return idx >= 0; });
+
+        graph->insertGlobalIndices(localRow + minGlobalIndex, cols.size(), cols.data());
+    }
+
+    graph->fillComplete(domainMap_, rangeMap_);
+
+    //- Map each entry of the equation to its slot in the (packed) local matrix values
+    auto colMap = graph->getColMap();
+    valOffsets_.assign(colInds.size(), -1);
+
+    for (Index localRow = 0, rowStart = 0; localRow < nLocalRows; ++localRow)
+    {
+        ArrayView<const Index> localCols;
+        graph->getLocalRowView(localRow, localCols);
+
+        for (Index j = rowPtr[localRow]; j < rowPtr[localRow + 1]; ++j)
+            if (colInds[j] >= 0)
+                valOffsets_[j] = rowStart + (std::find(localCols.begin(), localCols.end(),
+                                                       colMap->getLocalElement(colInds[j])) - localCols.begin());
+
+        rowStart += localCols.size();
+    }
+
+    graph_ = graph;
+    graphRowPtr_ = rowPtr;
+    graphColInd_ = colInds;
+
+    mat_ = rcp(new TpetraCrsMatrix(graph_));
+    mat_->fillComplete(domainMap_, rangeMap_);
+}
+
 //- External
 
 std::shared_ptr<TrilinosSparseMatrixSolver> multiply(const TrilinosSparseMatrixSolver &A, const TrilinosSparseMatrixSolver &B, bool transA, bool transB)
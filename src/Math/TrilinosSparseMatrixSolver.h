@@ -14,6 +14,7 @@ public:
     typedef Teuchos::MpiComm<Index> TeuchosComm;
     typedef Tpetra::Map<Index, Index> TpetraMap;
     typedef Tpetra::Operator<Scalar, Index, Index> TpetraOperator;
+    typedef Tpetra::CrsGraph<Index, Index> TpetraCrsGraph;
     typedef Tpetra::CrsMatrix<Scalar, Index, Index> TpetraCrsMatrix;
     typedef Tpetra::MultiVector<Scalar, Index, Index> TpetraMultiVector;
 
@@ -26,6 +27,8 @@ public:
 
     virtual void setRank(int rowRank, int colRank);
 
+    virtual void setup(const boost::property_tree::ptree &parameters) override;
+
     virtual void set(const CoefficientList &eqn) override;
 
     virtual void set(const std::vector<Index> &rowPtr, const std::vector<Index> &colInds, const std::vector<Scalar> &vals) override;
@@ -36,10 +39,15 @@ public:
 
     virtual void setRhs(const Vector &rhs);
 
+    virtual void setNumVectors(int nVectors) override;
+
     virtual Scalar solveLeastSquares();
 
     Scalar x(Index idx) const
-    { return xData_[idx]; }
+    { return xData_[0][idx]; }
+
+    Scalar x(Index idx, int vec) const
+    { return xData_[vec][idx]; }
 
     const Communicator &comm() const
     { return comm_; }
@@ -52,8 +60,15 @@ public:
     const Teuchos::RCP<TpetraCrsMatrix> &mat() const
     { return mat_; }
 
+    bool staticGraph() const
+    { return staticGraph_; }
+
 protected:
 
+    void resetMatrix();
+
+    void buildGraph(const std::vector<Index> &rowPtr, const std::vector<Index> &colInds);
+
     const Communicator &comm_;
 
     Teuchos::RCP<const TeuchosComm> Tcomm_;
@@ -66,7 +81,16 @@ protected:
 
     Teuchos::RCP<TpetraCrsMatrix> mat_;
 
-    Teuchos::ArrayRCP<const Scalar> xData_;
+    int nVectors_ = 1;
+
+    std::vector<Teuchos::ArrayRCP<const Scalar>> xData_;
+
+    //- Static graph, only rebuilt when the sparsity pattern of the equation changes
+    bool staticGraph_ = false;
+
+    Teuchos::RCP<const TpetraCrsGraph> graph_;
+
+    std::vector<Index> graphRowPtr_, graphColInd_, valOffsets_;
 };
 
 std::shared_ptr<TrilinosSparseMatrixSolver> multiply(const TrilinosSparseMatrixSolver &A, const TrilinosSparseMatrixSolver &B, bool transA = false, bool transB = false);
@@ -0,0 +1,170 @@
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "Math/StaticMatrix.h"
+
+//- Checks the dense:: LU solve, inverse and QR pseudo-inverse against LAPACK for all sizes up to maxSmallSize, and
+//- reports the time per call of both
+namespace
+{
+    const int nTimingCalls = 2000;
+    const Scalar tol = 1e-10;
+
+    std::mt19937 gen(1234);
+
+    //- Random m x n matrix, made diagonally dominant so that the comparisons are well conditioned
+    std::vector<Scalar> randomMatrix(int m, int n)
+    {
+        std::uniform_real_distribution<Scalar> dist(-1., 1.);
+        std::vector<Scalar> A(m * n);
+
+        for (Scalar &a: A)
+            a = dist(gen);
+
+        for (int i = 0; i < std::min(m, n); ++i)
+            A[i * n + i] += n;
+
+        return A;
+    }
+
+    std::vector<Scalar> identity(int m, int n)
+    {
+        std::vector<Scalar> I(m * n, 0.);
+
+        for (int i = 0; i < std::min(m, n); ++i)
+            I[i * n + i] = 1.;
+
+        return I;
+    }
+
+    //- Largest difference relative to the largest reference entry
+    Scalar error(const std::vector<Scalar> &x, const std::vector<Scalar> &ref, int size)
+    {
+        Scalar maxDiff = 0., maxRef = 0.;
+
+        for (int i = 0; i < size; ++i)
+        {
+            maxDiff = std::max(maxDiff, std::abs(x[i] - ref[i]));
+            maxRef = std::max(maxRef, std::abs(ref[i]));
+        }
+
+        return maxDiff / std::max(maxRef, 1.);
+    }
+
+    //- Average time per call in microseconds
+    template<class F>
+    double time(const F &f)
+    {
+        auto start = std::chrono::steady_clock::now();
+
+        for (int i = 0; i < nTimingCalls; ++i)
+            f();
+
+        return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count()
+               / nTimingCalls;
+    }
+
+    bool check(const char *kernel, int m, int n, Scalar err, double tDense, double tLapack)
+    {
+        bool pass = err <= tol;
+        std::printf("%-8s %3d %3d %12.3e %10.3f %11.3f %s\n", kernel, m, n, err, tDense, tLapack, pass ? "" : "FAILED");
+        return pass;
+    }
+
+    //- dense::lu and luSolve against dgesv, with three right-hand sides
+    bool testSolve(int n)
+    {
+        const int k = 3;
+        const std::vector<Scalar> A0 = randomMatrix(n, n), B0 = randomMatrix(n, k);
+        std::vector<Scalar> A, X, Xref;
+        std::vector<int> ipiv(n);
+
+        auto denseSolve = [&]()
+        {
+            A = A0;
+            X = B0;
+            dense::lu(n, A.data(), ipiv.data());
+            dense::luSolve(n, k, A.data(), ipiv.data(), X.data());
+        };
+
+        auto lapackSolve = [&]()
+        {
+            A = A0;
+            Xref = B0;
+            LAPACKE_dgesv(LAPACK_ROW_MAJOR, n, k, A.data(), n, ipiv.data(), Xref.data(), k);
+        };
+
+        double tDense = time(denseSolve), tLapack = time(lapackSolve);
+        return check("solve", n, n, error(X, Xref, n * k), tDense, tLapack);
+    }
+
+    //- dense::invert against dgetrf and dgetri
+    bool testInvert(int n)
+    {
+        const std::vector<Scalar> A0 = randomMatrix(n, n);
+        std::vector<Scalar> A, Ainv(n * n);
+        std::vector<int> ipiv(n);
+
+        auto denseInvert = [&]()
+        {
+            A = A0;
+            dense::invert(n, A.data(), ipiv.data(), Ainv.data());
+        };
+
+        auto lapackInvert = [&]()
+        {
+            A = A0;
+            LAPACKE_dgetrf(LAPACK_ROW_MAJOR, n, n, A.data(), n, ipiv.data());
+            LAPACKE_dgetri(LAPACK_ROW_MAJOR, n, A.data(), n, ipiv.data());
+        };
+
+        double tDense = time(denseInvert), tLapack = time(lapackInvert);
+        return check("invert", n, n, error(Ainv, A, n * n), tDense, tLapack);
+    }
+
+    //- dense::qrPseudoInverse against dgels with an identity right-hand side, as in pseudoInverse
+    bool testPseudoInverse(int m, int n)
+    {
+        const std::vector<Scalar> A0 = randomMatrix(m, n);
+        std::vector<Scalar> A, P(n * m), I, work(m * m);
+        bool factored = true;
+
+        auto densePinv = [&]()
+        {
+            A = A0;
+            factored = dense::qrPseudoInverse(m, n, A.data(), P.data(), work.data()) && factored;
+        };
+
+        auto lapackPinv = [&]()
+        {
+            A = A0;
+            I = identity(m, m);
+            LAPACKE_dgels(LAPACK_ROW_MAJOR, 'N', m, n, m, A.data(), n, I.data(), m);
+        };
+
+        double tDense = time(densePinv), tLapack = time(lapackPinv);
+        return check("pinv", m, n, factored ? error(P, I, n * m) : 1., tDense, tLapack);
+    }
+}
+
+int main()
+{
+    bool pass = true;
+
+    std::printf("%-8s %3s %3s %12s %10s %11s\n", "kernel", "m", "n", "rel. error", "dense (us)", "LAPACK (us)");
+
+    for (int n = 1; n <= dense::maxSmallSize; ++n)
+    {
+        pass = testSolve(n) && pass;
+        pass = testInvert(n) && pass;
+
+        for (int m = n; m <= dense::maxSmallSize; ++m)
+            pass = testPseudoInverse(m, n) && pass;
+    }
+
+    std::printf("%s\n", pass ? "All dense kernels agree with LAPACK." : "Some dense kernels disagree with LAPACK.");
+
+    return pass ? 0 : 1;
+}
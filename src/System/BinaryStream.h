@@ -0,0 +1,64 @@
+#ifndef PHASE_BINARY_STREAM_H
+#define PHASE_BINARY_STREAM_H
+
+#include <string>
+#include <vector>
+#include <istream>
+#include <ostream>
+
+#include "Exception.h"
+
+//- Raw reads and writes of trivially copyable values, vectors and strings, as used by the checkpoint files.
+//- Vectors are preceded by their size, and are only read back into vectors of the same size
+namespace binary
+{
+    template<class T>
+    void write(std::ostream &os, const T &val)
+    { os.write(reinterpret_cast<const char*>(&val), sizeof(T)); }
+
+    template<class T>
+    void write(std::ostream &os, const std::vector<T> &vals)
+    {
+        write(os, (unsigned long) vals.size());
+        os.write(reinterpret_cast<const char*>(vals.data()), sizeof(T) * vals.size());
+    }
+
+    inline void write(std::ostream &os, const std::string &str)
+    {
+        write(os, (unsigned long) str.size());
+        os.write(str.data(), str.size());
+    }
+
+    template<class T>
+    void read(std::istream &is, T &val)
+    {
+        if (!is.read(reinterpret_cast<char*>(&val), sizeof(T)))
+            throw Exception("binary", "read", "unexpected end of stream.");
+    }
+
+    template<class T>
+    void read(std::istream &is, std::vector<T> &vals)
+    {
+        unsigned long size;
+        read(is, size);
+
+        if (size != vals.size())
+            throw Exception("binary", "read", "expected " + std::to_string(vals.size()) + " values, stream has "
+                                              + std::to_string(size) + ".");
+
+        if (!is.read(reinterpret_cast<char*>(vals.data()), sizeof(T) * vals.size()))
+            throw Exception("binary", "read", "unexpected end of stream.");
+    }
+
+    inline void read(std::istream &is, std::string &str)
+    {
+        unsigned long size;
+        read(is, size);
+        str.resize(size);
+
+        if (!is.read(&str[0], size))
+            throw Exception("binary", "read", "unexpected end of stream.");
+    }
+}
+
+#endif
@@ -1,7 +1,14 @@
 #include <numeric>
+#include <cstdint>
+#include <sstream>
+#include <iomanip>
 
 #include <cgnslib.h>
 
+#ifdef PHASE_PCGNS
+#include <pcgnslib.h>
+#endif
+
 #include "CgnsFile.h"
 #include "Exception.h"
 
@@ -10,11 +17,24 @@ CgnsFile::CgnsFile(const std::string &filename, Mode mode)
     open(filename, mode);
 }
 
+CgnsFile::CgnsFile(const std::string &filename, Mode mode, MPI_Comm comm)
+{
+    open(filename, mode, comm);
+}
+
 CgnsFile::~CgnsFile()
 {
     close();
 }
 
+void CgnsFile::setCompression(int level)
+{
+    if (level < 0 || level > 9)
+        throw Exception("CgnsFile", "setCompression", "compression level must be between 0 and 9.");
+
+    cg_configure(CG_CONFIG_HDF5_COMPRESS, (void *) (intptr_t) level);
+}
+
 int CgnsFile::open(const std::string &filename, Mode mode)
 {
     close();
@@ -37,8 +57,48 @@ int CgnsFile::open(const std::string &filename, Mode mode)
     return _fid;
 }
 
+int CgnsFile::open(const std::string &filename, Mode mode, MPI_Comm comm)
+{
+    close();
+
+#ifdef PHASE_PCGNS
+    _parallel = true;
+    _comm = comm;
+
+    cgp_mpi_comm(comm);
+
+    switch (mode)
+    {
+        case READ:
+            cgp_open(filename.c_str(), CG_MODE_READ, &_fid);
+            break;
+
+        case WRITE:
+            cgp_open(filename.c_str(), CG_MODE_WRITE, &_fid);
+            break;
+
+        case MODIFY:
+            cgp_open(filename.c_str(), CG_MODE_MODIFY, &_fid);
+            break;
+    }
+
+    return _fid;
+#else
+    throw Exception("CgnsFile", "open", "parallel CGNS is not available, rebuild against a parallel CGNS library.");
+#endif
+}
+
 void CgnsFile::close()
 {
+#ifdef PHASE_PCGNS
+    if (_parallel)
+    {
+        cgp_close(_fid);
+        _parallel = false;
+        return;
+    }
+#endif
+
     cg_close(_fid);
 }
 
@@ -125,20 +185,42 @@ std::tuple<int, int, int> CgnsFile::writeCoordinates(int bid, int zid, const std
     return cid;
 }
 
+std::tuple<int, int> CgnsFile::writeCoordinates(int bid, int zid, int rmin, int rmax, const std::vector<Point2D> &coords)
+{
+    std::tuple<int, int> cid;
+
+#ifdef PHASE_PCGNS
+    std::vector<double> x(coords.size()), y(coords.size());
+    std::transform(coords.begin(), coords.end(), x.begin(), [](const Point2D &pt)
+    { return pt.x; });
+    std::transform(coords.begin(), coords.end(), y.begin(), [](const Point2D &pt)
+    { return pt.y; });
+
+    cgsize_t rangeMin = rmin, rangeMax = rmax;
+    cgp_coord_write(_fid, bid, zid, CGNS_ENUMV(RealDouble), "CoordinateX", &std::get<0>(cid));
+    cgp_coord_write(_fid, bid, zid, CGNS_ENUMV(RealDouble), "CoordinateY", &std::get<1>(cid));
+    cgp_coord_write_data(_fid, bid, zid, std::get<0>(cid), &rangeMin, &rangeMax, x.data());
+    cgp_coord_write_data(_fid, bid, zid, std::get<1>(cid), &rangeMin, &rangeMax, y.data());
+#else
+    throw Exception("CgnsFile", "writeCoordinates", "parallel CGNS is not available.");
+#endif
+
+    return cid;
+}
+
 template<>
-std::vector<Point2D> CgnsFile::readCoords(int bid, int zid) const
+std::vector<Point2D> CgnsFile::readCoords(int bid, int zid, int rmin, int rmax) const
 {
-    char buff[256];
-    cgsize_t size[3];
-    cg_zone_read(_fid, bid, zid, buff, size);
+    std::vector<double> xCoord(std::max(rmax - rmin + 1, 0)), yCoord(std::max(rmax - rmin + 1, 0));
 
-    std::vector<double> xCoord(size[0]), yCoord(size[0]);
+    if (xCoord.empty())
+        return std::vector<Point2D>();
 
-    cgsize_t rmin = 1, rmax = size[0];
-    cg_coord_read(_fid, bid, zid, "CoordinateX", CGNS_ENUMV(RealDouble), &rmin, &rmax, xCoord.data());
-    cg_coord_read(_fid, bid, zid, "CoordinateY", CGNS_ENUMV(RealDouble), &rmin, &rmax, yCoord.data());
+    cgsize_t rangeMin = rmin, rangeMax = rmax;
+    cg_coord_read(_fid, bid, zid, "CoordinateX", CGNS_ENUMV(RealDouble), &rangeMin, &rangeMax, xCoord.data());
+    cg_coord_read(_fid, bid, zid, "CoordinateY", CGNS_ENUMV(RealDouble), &rangeMin, &rangeMax, yCoord.data());
 
-    std::vector<Point2D> coords(size[0]);
+    std::vector<Point2D> coords(xCoord.size());
     std::transform(xCoord.begin(), xCoord.end(), yCoord.begin(), coords.begin(), [](Scalar x, Scalar y)
     {
         return Point2D(x, y);
@@ -147,6 +229,16 @@ std::vector<Point2D> CgnsFile::readCoords(int bid, int zid) const
     return coords;
 }
 
+template<>
+std::vector<Point2D> CgnsFile::readCoords(int bid, int zid) const
+{
+    char buff[256];
+    cgsize_t size[3];
+    cg_zone_read(_fid, bid, zid, buff, size);
+
+    return readCoords<Point2D>(bid, zid, 1, size[0]);
+}
+
 int CgnsFile::createStructuredZone(int bid, const std::string &zonename,
                                    int nNodesI, int nNodesJ,
                                    int nCellsI, int nCellsJ)
@@ -192,6 +284,12 @@ int CgnsFile::nSections(int bid, int zid) const
 }
 
 CgnsFile::Section CgnsFile::readSection(int bid, int zid, int sid) const
+{
+    Section info = readSectionInfo(bid, zid, sid);
+    return readSection(bid, zid, sid, info.start, info.end);
+}
+
+CgnsFile::Section CgnsFile::readSectionInfo(int bid, int zid, int sid) const
 {
     char buff[256];
     CGNS_ENUMT(ElementType_t) type;
@@ -201,11 +299,47 @@ CgnsFile::Section CgnsFile::readSection(int bid, int zid, int sid) const
     cg_section_read(_fid, bid, zid, sid, buff, &type, &section.start, &section.end, &section.nbndry,
                     &section.parentFlag);
 
+    section.id = sid;
+    section.name = std::string(buff);
+    section.type = std::string(cg_ElementTypeName(type));
+    section.cptr.assign(1, 0);
+
+    return section;
+}
+
+CgnsFile::Section CgnsFile::readSection(int bid, int zid, int sid, int start, int end) const
+{
+    char buff[256];
+    CGNS_ENUMT(ElementType_t) type;
+
+    Section section;
+
+    cg_section_read(_fid, bid, zid, sid, buff, &type, &section.start, &section.end, &section.nbndry,
+                    &section.parentFlag);
+
+    if (start < section.start || end > section.end)
+        throw Exception("CgnsFile", "readSection", "element range is outside of section \"" + std::string(buff) + "\".");
+
+    section.id = sid;
+    section.name = std::string(buff);
+    section.type = std::string(cg_ElementTypeName(type));
+    section.start = start;
+    section.end = end;
+    section.cptr.assign(1, 0);
+
+    if (end < start)
+        return section;
+
     cgsize_t dataSize;
-    cg_ElementDataSize(_fid, bid, zid, sid, &dataSize);
+    cg_ElementPartialSize(_fid, bid, zid, sid, start, end, &dataSize);
 
     std::vector<cgsize_t> elements(dataSize);
-    cg_elements_read(_fid, bid, zid, sid, elements.data(), nullptr);
+    cg_elements_partial_read(_fid, bid, zid, sid, start, end, elements.data(), nullptr);
+
+    std::vector<int> eptr, eind;
+    eptr.reserve(end - start + 2);
+    eind.reserve(dataSize);
+    eptr.push_back(0);
 
     auto getNVerts = [](CGNS_ENUMT(ElementType_t) type)
     {
@@ -224,8 +358,6 @@ CgnsFile::Section CgnsFile::readSection(int bid, int zid, int sid) const
         }
     };
 
-    std::vector<int> eptr(1, 0), eind;
-
     int nVerts;
     if (type == CGNS_ENUMV(MIXED))
     {
@@ -242,47 +374,55 @@ CgnsFile::Section CgnsFile::readSection(int bid, int zid, int sid) const
     {
         nVerts = getNVerts(type);
 
-        for (int i = 0; i < section.end - section.start + 1; ++i)
+        for (int i = 0; i < end - start + 1; ++i)
         {
             eptr.push_back(eptr.back() + nVerts);
             eind.insert(eind.end(), elements.begin() + nVerts * i, elements.begin() + nVerts * (i + 1));
         }
     }
 
-    section.id = sid;
-    section.name = std::string(buff);
-    section.type = std::string(cg_ElementTypeName(type));
     section.cptr = std::move(eptr);
     section.cind = std::move(eind);
 
     return section;
 }
 
-int CgnsFile::writeMixedElementSection(int bid, int zid, const std::string &sectionname,
-                                       int start, int end, const std::vector<int> &eptr, const std::vector<int> &eind)
+namespace
 {
-    std::vector<cgsize_t> elements;
-
-    for (auto i = 0; i < eptr.size() - 1; ++i)
+    //- Mixed element connectivity, each element is its type followed by its node ids
+    std::vector<cgsize_t> mixedElements(const std::vector<int> &eptr, const std::vector<int> &eind)
     {
+        std::vector<cgsize_t> elements;
 
-        switch (eptr[i + 1] - eptr[i])
+        for (auto i = 0; i < eptr.size() - 1; ++i)
         {
-            case 2:
-                elements.push_back(CGNS_ENUMV(BAR_2));
-                break;
-            case 3:
-                elements.push_back(CGNS_ENUMV(TRI_3));
-                break;
-            case 4:
-                elements.push_back(CGNS_ENUMV(QUAD_4));
-                break;
-            default:
-                throw Exception("CgnsFile", "writeMixedElementSection", "bad element.");
+
+            switch (eptr[i + 1] - eptr[i])
+            {
+                case 2:
+                    elements.push_back(CGNS_ENUMV(BAR_2));
+                    break;
+                case 3:
+                    elements.push_back(CGNS_ENUMV(TRI_3));
+                    break;
+                case 4:
+                    elements.push_back(CGNS_ENUMV(QUAD_4));
+                    break;
+                default:
+                    throw Exception("CgnsFile", "writeMixedElementSection", "bad element.");
+            }
+
+            elements.insert(elements.end(), eind.begin() + eptr[i], eind.begin() + eptr[i + 1]);
         }
 
-        elements.insert(elements.end(), eind.begin() + eptr[i], eind.begin() + eptr[i + 1]);
+        return elements;
     }
+}
+
+int CgnsFile::writeMixedElementSection(int bid, int zid, const std::string &sectionname,
+                                       int start, int end, const std::vector<int> &eptr, const std::vector<int> &eind)
+{
+    std::vector<cgsize_t> elements = mixedElements(eptr, eind);
 
     int sid;
     cg_section_write(_fid, bid, zid, sectionname.c_str(), CGNS_ENUMV(MIXED), start, end, 0, elements.data(), &sid);
@@ -290,6 +430,36 @@ int CgnsFile::writeMixedElementSection(int bid, int zid, const std::string &sect
     return sid;
 }
 
+int CgnsFile::writeMixedElementSection(int bid, int zid, const std::string &sectionname,
+                                       int start, int end, int rmin, int rmax,
+                                       const std::vector<int> &eptr, const std::vector<int> &eind)
+{
+#ifdef PHASE_PCGNS
+    std::vector<cgsize_t> elements = mixedElements(eptr, eind);
+
+    //- Offsets index the connectivity of the whole section
+    long long localSize = elements.size(), maxOffset = 0, offset = 0;
+    MPI_Allreduce(&localSize, &maxOffset, 1, MPI_LONG_LONG, MPI_SUM, _comm);
+    MPI_Exscan(&localSize, &offset, 1, MPI_LONG_LONG, MPI_SUM, _comm);
+
+    int rank;
+    MPI_Comm_rank(_comm, &rank);
+
+    std::vector<cgsize_t> offsets(1, rank == 0 ? 0 : offset);
+
+    for (auto i = 0; i < eptr.size() - 1; ++i)
+        offsets.push_back(offsets.back() + 1 + eptr[i + 1] - eptr[i]);
+
+    int sid;
+    cgp_poly_section_write(_fid, bid, zid, sectionname.c_str(), CGNS_ENUMV(MIXED), start, end, maxOffset, 0, &sid);
+    cgp_poly_elements_write_data(_fid, bid, zid, sid, rmin, rmax, elements.data(), offsets.data());
+
+    return sid;
+#else
+    throw Exception("CgnsFile", "writeMixedElementSection", "parallel CGNS is not available.");
+#endif
+}
+
 int CgnsFile::writeBarElementSection(int bid, int zid, const std::string &sectionname, int start, int end,
                                      const std::vector<int> &elements)
 {
@@ -425,6 +595,20 @@ CgnsFile::Field<double> CgnsFile::readField(int bid, int zid, int sid, int rmin,
     field.rmax = {rmax, 1, 1};
     field.data.resize(rmax - rmin + 1);
 
+    //- Single precision data is converted on read, the stored type is reported in field.type
+    int nFields = 0;
+    cg_nfields(_fid, bid, zid, sid, &nFields);
+
+    for (int i = 1; i <= nFields; ++i)
+    {
+        char buff[256];
+        CGNS_ENUMT(DataType_t) type;
+        cg_field_info(_fid, bid, zid, sid, i, &type, buff);
+
+        if (fieldname == buff)
+            field.type = cg_DataTypeName(type);
+    }
+
     cg_field_read(_fid, bid, zid, sid,
                   field.name.c_str(),
                   CGNS_ENUMV(RealDouble),
@@ -436,7 +620,8 @@ CgnsFile::Field<double> CgnsFile::readField(int bid, int zid, int sid, int rmin,
 }
 
 template<>
-int CgnsFile::writeField(int bid, int zid, int sid, const std::string &fieldname, const std::vector<int> &field)
+int CgnsFile::writeField(int bid, int zid, int sid, const std::string &fieldname, const std::vector<int> &field,
+                         Precision precision)
 {
     int fid;
     cg_field_write(_fid, bid, zid, sid, CGNS_ENUMV(Integer), fieldname.c_str(), field.data(), &fid);
@@ -444,24 +629,86 @@ int CgnsFile::writeField(int bid, int zid, int sid, const std::string &fieldname
 }
 
 template<>
-int CgnsFile::writeField(int bid, int zid, int sid, const std::string &fieldname, const std::vector<Label> &field)
+int CgnsFile::writeField(int bid, int zid, int sid, const std::string &fieldname, const std::vector<Label> &field,
+                         Precision precision)
 {
     return writeField(bid, zid, sid, fieldname, std::vector<int>(field.begin(), field.end()));
 }
 
 template<>
-int CgnsFile::writeField(int bid, int zid, int sid, const std::string &fieldname, const std::vector<double> &field)
+int CgnsFile::writeField(int bid, int zid, int sid, const std::string &fieldname, const std::vector<double> &field,
+                         Precision precision)
+{
+    int fid;
+
+    if (precision == SINGLE)
+    {
+        std::vector<float> data(field.begin(), field.end());
+        cg_field_write(_fid, bid, zid, sid, CGNS_ENUMV(RealSingle), fieldname.c_str(), data.data(), &fid);
+    }
+    else
+        cg_field_write(_fid, bid, zid, sid, CGNS_ENUMV(RealDouble), fieldname.c_str(), field.data(), &fid);
+
+    return fid;
+}
+
+template<>
+int CgnsFile::writeField(int bid, int zid, int sid, const std::string &fieldname, const std::vector<Vector2D> &field,
+                         Precision precision)
 {
+    std::vector<double> xComp(field.size()), yComp(field.size());
+
+    std::transform(field.begin(), field.end(), xComp.begin(), [](const Vector2D &u)
+    { return u.x; });
+
+    std::transform(field.begin(), field.end(), yComp.begin(), [](const Vector2D &u)
+    { return u.y; });
+
+    writeField(bid, zid, sid, fieldname + "X", xComp, precision);
+    return writeField(bid, zid, sid, fieldname + "Y", yComp, precision);
+}
+
+template<>
+int CgnsFile::writeField(int bid, int zid, int sid, const std::string &fieldname,
+                         int rmin, int rmax, const std::vector<int> &field)
+{
+#ifdef PHASE_PCGNS
     int fid;
-    auto data = field;
-    cg_field_write(_fid, bid, zid, sid, CGNS_ENUMV(RealDouble), fieldname.c_str(), data.data(), &fid);
+    cgsize_t rangeMin = rmin, rangeMax = rmax;
+    cgp_field_write(_fid, bid, zid, sid, CGNS_ENUMV(Integer), fieldname.c_str(), &fid);
+    cgp_field_write_data(_fid, bid, zid, sid, fid, &rangeMin, &rangeMax, field.data());
     return fid;
+#else
+    throw Exception("CgnsFile", "writeField", "parallel CGNS is not available.");
+#endif
+}
+
+template<>
+int CgnsFile::writeField(int bid, int zid, int sid, const std::string &fieldname,
+                         int rmin, int rmax, const std::vector<Label> &field)
+{
+    return writeField(bid, zid, sid, fieldname, rmin, rmax, std::vector<int>(field.begin(), field.end()));
 }
 
 template<>
-int CgnsFile::writeField(int bid, int zid, int sid, const std::string &fieldname, const std::vector<Vector2D> &field)
+int CgnsFile::writeField(int bid, int zid, int sid, const std::string &fieldname,
+                         int rmin, int rmax, const std::vector<double> &field)
 {
+#ifdef PHASE_PCGNS
     int fid;
+    cgsize_t rangeMin = rmin, rangeMax = rmax;
+    cgp_field_write(_fid, bid, zid, sid, CGNS_ENUMV(RealDouble), fieldname.c_str(), &fid);
+    cgp_field_write_data(_fid, bid, zid, sid, fid, &rangeMin, &rangeMax, field.data());
+    return fid;
+#else
+    throw Exception("CgnsFile", "writeField", "parallel CGNS is not available.");
+#endif
+}
+
+template<>
+int CgnsFile::writeField(int bid, int zid, int sid, const std::string &fieldname,
+                         int rmin, int rmax, const std::vector<Vector2D> &field)
+{
     std::vector<double> xComp(field.size()), yComp(field.size());
 
     std::transform(field.begin(), field.end(), xComp.begin(), [](const Vector2D &u)
@@ -470,10 +717,29 @@ int CgnsFile::writeField(int bid, int zid, int sid, const std::string &fieldname
     std::transform(field.begin(), field.end(), yComp.begin(), [](const Vector2D &u)
     { return u.y; });
 
-    writeField(bid, zid, sid, fieldname + "X", xComp);
-    writeField(bid, zid, sid, fieldname + "Y", yComp);
+    writeField(bid, zid, sid, fieldname + "X", rmin, rmax, xComp);
+    return writeField(bid, zid, sid, fieldname + "Y", rmin, rmax, yComp);
+}
 
-    return fid;
+void CgnsFile::writeIterativeData(int bid, int zid,
+                                  const std::vector<double> &timeValues, const std::vector<std::string> &solnNames)
+{
+    std::ostringstream solnPtrs;
+
+    for (const std::string &name: solnNames)
+        solnPtrs << std::setw(32) << std::setfill(' ') << std::left << name;
+
+    cgsize_t dims[] = {32, (cgsize_t) solnNames.size()}, nSteps = timeValues.size();
+
+    cg_ziter_write(_fid, bid, zid, "ZoneIterativeData");
+    cg_goto(_fid, bid, "Zone_t", zid, "ZoneIterativeData_t", 1, "end");
+    cg_array_write("FlowSolutionPointers", CGNS_ENUMV(Character), 2, dims, solnPtrs.str().c_str());
+
+    cg_biter_write(_fid, bid, "TimeIterValues", timeValues.size());
+    cg_goto(_fid, bid, "BaseIterativeData_t", 1, "end");
+    cg_array_write("TimeValues", CGNS_ENUMV(RealDouble), 1, &nSteps, timeValues.data());
+
+    cg_simulation_type_write(_fid, bid, CGNS_ENUMV(TimeAccurate));
 }
 
 int CgnsFile::nDescriptorNodes(int bid) const
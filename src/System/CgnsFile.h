@@ -4,6 +4,8 @@
 #include <string>
 #include <vector>
 
+#include <mpi.h>
+
 #include "2D/Geometry/Point2D.h"
 #include "3D/Geometry/Point3D.h"
 
@@ -16,6 +18,12 @@ public:
         READ, WRITE, MODIFY
     };
 
+    //- Storage precision of real fields, data is always passed in double precision
+    enum Precision
+    {
+        SINGLE, DOUBLE
+    };
+
     struct Base
     {
         std::string name;
@@ -62,10 +70,18 @@ public:
 
     CgnsFile(const std::string &filename, Mode mode = READ);
 
+    //- Parallel file opened through pcgns, every proc in comm must make the same calls
+    CgnsFile(const std::string &filename, Mode mode, MPI_Comm comm);
+
     ~CgnsFile();
 
+    //- Deflate level (0-9) of the chunked HDF5 datasets created from now on by any file, 0 disables compression
+    static void setCompression(int level);
+
     int open(const std::string &filename, Mode mode);
 
+    int open(const std::string &filename, Mode mode, MPI_Comm comm);
+
     void close();
 
     int createBase(const std::string &basename, int cellDim, int physDim);
@@ -83,9 +99,16 @@ public:
 
     std::tuple<int, int, int> writeCoordinates(int bid, int zid, const std::vector<Point3D> &coords);
 
+    //- Parallel write of the coordinates of nodes rmin to rmax (one-based, inclusive)
+    std::tuple<int, int> writeCoordinates(int bid, int zid, int rmin, int rmax, const std::vector<Point2D> &coords);
+
     template<class T>
     std::vector<T> readCoords(int bid, int zid) const;
 
+    //- Reads the coordinates of nodes rmin to rmax (one-based, inclusive)
+    template<class T>
+    std::vector<T> readCoords(int bid, int zid, int rmin, int rmax) const;
+
     int createStructuredZone(int bid, const std::string &zonename,
                              int nNodesI, int nNodesJ,
                              int nCellsI, int nCellsJ);
@@ -102,9 +125,20 @@ public:
 
     Section readSection(int bid, int zid, int sid) const;
 
+    //- Section info only, without the element connectivity
+    Section readSectionInfo(int bid, int zid, int sid) const;
+
+    //- Reads elements start to end (one-based, inclusive) of a section
+    Section readSection(int bid, int zid, int sid, int start, int end) const;
+
     int writeMixedElementSection(int bid, int zid, const std::string &sectionname,
                                  int start, int end, const std::vector<int> &eptr, const std::vector<int> &eind);
 
+    //- Parallel write of a section spanning start to end, of which this proc holds elements rmin to rmax
+    int writeMixedElementSection(int bid, int zid, const std::string &sectionname,
+                                 int start, int end, int rmin, int rmax,
+                                 const std::vector<int> &eptr, const std::vector<int> &eind);
+
     int writeBarElementSection(int bid, int zid, const std::string &sectionname,
                                int start, int end, const std::vector<int> &elements);
 
@@ -136,7 +170,17 @@ public:
     Field<T> readField(int bid, int zid, int sid, int rmin, int rmax, const std::string& fieldname);
 
     template<class T>
-    int writeField(int bid, int zid, int sid, const std::string &fieldname, const std::vector<T> &field);
+    int writeField(int bid, int zid, int sid, const std::string &fieldname, const std::vector<T> &field,
+                   Precision precision = DOUBLE);
+
+    //- Parallel write of the values of cells rmin to rmax (one-based, inclusive)
+    template<class T>
+    int writeField(int bid, int zid, int sid, const std::string &fieldname,
+                   int rmin, int rmax, const std::vector<T> &field);
+
+    //- Time values and flow solution names, in the layout of the reconstructed solutions
+    void writeIterativeData(int bid, int zid,
+                            const std::vector<double> &timeValues, const std::vector<std::string> &solnNames);
 
     //- Descriptors
 
@@ -149,6 +193,10 @@ public:
 protected:
 
     int _fid;
+
+    bool _parallel = false;
+
+    MPI_Comm _comm = MPI_COMM_NULL;
 };
 
 
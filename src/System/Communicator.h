@@ -107,6 +107,39 @@ public:
         return result;
     }
 
+    //- Alltoallv, vals[proc] is sent to proc and the result holds what was received from each proc
+    template<class T>
+    std::vector<std::vector<T>> allToAllv(const std::vector<std::vector<T>> &vals) const
+    {
+        std::vector<int> sendSizes(nProcs()), recvSizes(nProcs());
+
+        for (int proc = 0; proc < nProcs(); ++proc)
+            sendSizes[proc] = sizeof(T) * vals[proc].size();
+
+        MPI_Alltoall(sendSizes.data(), 1, MPI_INT, recvSizes.data(), 1, MPI_INT, comm_);
+
+        std::vector<int> sendDispls(nProcs(), 0), recvDispls(nProcs(), 0);
+        std::partial_sum(sendSizes.begin(), sendSizes.end() - 1, sendDispls.begin() + 1);
+        std::partial_sum(recvSizes.begin(), recvSizes.end() - 1, recvDispls.begin() + 1);
+
+        std::vector<T> sendBuffer, recvBuffer((recvDispls.back() + recvSizes.back()) / sizeof(T));
+        sendBuffer.reserve((sendDispls.back() + sendSizes.back()) / sizeof(T));
+
+        for (const std::vector<T> &val: vals)
+            sendBuffer.insert(sendBuffer.end(), val.begin(), val.end());
+
+        MPI_Alltoallv(sendBuffer.data(), sendSizes.data(), sendDispls.data(), MPI_BYTE,
+                      recvBuffer.data(), recvSizes.data(), recvDispls.data(), MPI_BYTE, comm_);
+
+        std::vector<std::vector<T>> result(nProcs());
+
+        for (int proc = 0; proc < nProcs(); ++proc)
+            result[proc].assign(recvBuffer.begin() + recvDispls[proc] / sizeof(T),
+                                recvBuffer.begin() + (recvDispls[proc] + recvSizes[proc]) / sizeof(T));
+
+        return result;
+    }
+
     //- Blocking point-to-point communication
     template<class T>
     void ssend(int dest, const std::vector<T> &vals, int tag = MPI_ANY_TAG) const
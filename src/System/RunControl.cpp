@@ -9,6 +9,10 @@ void RunControl::run(const CommandLine &cl,
     auto maxWallTime =
             input.caseInput().get<Scalar>("Solver.maxWallTime", std::numeric_limits<Scalar>::infinity()) * 3600;
 
+    //- Checkpoints are written when the wall time runs out, and optionally at a wall time interval
+    auto checkpointInterval =
+            input.caseInput().get<Scalar>("Solver.checkpointInterval", std::numeric_limits<Scalar>::infinity()) * 3600;
+
     //- Time step conditions
     Scalar maxTime = input.caseInput().get<Scalar>("Solver.maxTime");
     Scalar maxCo = input.caseInput().get<Scalar>("Solver.maxCo");
@@ -18,24 +22,40 @@ void RunControl::run(const CommandLine &cl,
     solver.printf("%s", solver.info().c_str());
     solver.printf("%s\n", (std::string(96, '-')).c_str());
 
-    //- Initial conditions
+    //- Initial conditions. A checkpoint also holds the state that initialize derives from the fields, such as the
+    //- corrected face velocities and the property histories, so the solver is only initialized without one
+    Scalar time;
+    Scalar timeStep = input.caseInput().get<Scalar>("Solver.initialTimeStep", solver.maxTimeStep());
+
     solver.setInitialConditions(cl, input);
-    solver.initialize();
 
-    //- Time
-    Scalar time = solver.getStartTime();
-    Scalar timeStep = input.caseInput().get<Scalar>("Solver.initialTimeStep", solver.maxTimeStep());
+    bool fromCheckpoint = cl.get<bool>("restart") && solver.readCheckpoint(time, timeStep);
+
+    if (!fromCheckpoint)
+        solver.initialize();
+
+    //- Time, a checkpoint sets the start time
+    time = solver.getStartTime();
 
     //- Initial output
     postProcessing.compute(0., true);
 
     time_.start();
+    Scalar nextCheckpoint = checkpointInterval;
+
     for (
          size_t iterNo = 0;
          time < maxTime && time_.elapsedSeconds(solver.comm()) < maxWallTime;
          time += timeStep, timeStep = solver.computeMaxTimeStep(maxCo, timeStep), ++iterNo
          )
     {
+        //- Written before the step, once the next time step is known
+        if (time_.elapsedSeconds(solver.comm()) >= nextCheckpoint)
+        {
+            solver.writeCheckpoint(time, timeStep);
+            nextCheckpoint += checkpointInterval;
+        }
+
         solver.solve(timeStep);
         postProcessing.compute(time + timeStep, false);
 
@@ -50,6 +70,12 @@ void RunControl::run(const CommandLine &cl,
     }
     time_.stop();
 
+    if (time < maxTime)
+    {
+        solver.printf("Maximum wall time reached, writing checkpoint at t = %lf s...\n", time);
+        solver.writeCheckpoint(time, timeStep);
+    }
+
     solver.printf("%s\n", (std::string(96, '*')).c_str());
     solver.printf("Calculation complete.\n");
     solver.printf("Elapsed time: %s\n", time_.elapsedTime().c_str());
@@ -16,6 +16,7 @@ public:
     virtual std::string info() const
     {}
 
+    //- Derives the remaining state from the initial fields, not called when restarting from a checkpoint
     virtual void initialize() = 0;
 
     virtual void setInitialConditions(const Input &input) = 0;
@@ -28,6 +29,13 @@ public:
 
     virtual Scalar solve(Scalar timeStep) = 0;
 
+    //- Checkpoints of the complete solver state, solvers without support write nothing and never restart from one
+    virtual void writeCheckpoint(Scalar time, Scalar timeStep) const
+    {}
+
+    virtual bool readCheckpoint(Scalar &time, Scalar &timeStep)
+    { return false; }
+
     virtual int printf(const char *format, ...) const = 0;
 
     virtual const Communicator& comm() const = 0;
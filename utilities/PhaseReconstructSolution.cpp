@@ -278,6 +278,7 @@ int main(int argc, char *argv[])
                     intFields[name].insert(intFields[name].end(), buffer.begin(), buffer.end());
                 }
                     break;
+                case CGNS_ENUMV(RealSingle):
                 case CGNS_ENUMV(RealDouble):
                 {
                     std::vector<double> buffer(sizes[1]);